@@ -0,0 +1,110 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+// Compares parsing a CSV into standard containers, allocated one by one with the global
+// allocator, against parsing it into `std::pmr` containers in a `tpc::session`'s arena.
+// Reports, as JSON, the allocations by the global operator new, and the time spent
+// parsing and freeing the parse tree.
+//
+// Usage: arena [size=N] [filter=S] [runs=N] [min_time=S]
+// See benchmarks/bench.hpp for the options.
+
+#include <cctype>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include <tpc/parser/session.hpp>
+#include <tpc/parser/combinators/or.hpp>
+#include <tpc/parser/combinators/sepby.hpp>
+#include <tpc/parser/combinators/sependby.hpp>
+#include <tpc/parser/standard/char.hpp>
+#include <tpc/parser/standard/span.hpp>
+#include <tpc/parser/standard/string.hpp>
+
+#include "bench.hpp"
+
+
+bool isIdent(char c) {
+  return std::isprint(c)
+      && c != tpc::Char::Comma
+      && c != tpc::Char::DoubleQuote;
+}
+
+
+// The grammar of examples/csv.cpp, for the supplied string and container types.
+template<template<typename> typename Vector, typename String>
+struct csv {
+  typedef Vector<String> Line;
+  typedef Vector<Line> CSV;
+  
+  static constexpr tpc::parser<String> cell = tpc::orP< String, tpc::string<String>
+                                                              , tpc::span1<String, isIdent> >;
+  
+  static constexpr tpc::parser<Line> line = tpc::sepBy1<char, tpc::comma, Line, cell>;
+  
+  static constexpr tpc::parser<CSV> file = tpc::sepEndBy< tpc::void_t, tpc::newline,
+                                                          CSV,         line          >;
+};
+
+template<typename T>
+using vector = std::vector<T>;
+
+template<typename T>
+using pmr_vector = std::pmr::vector<T>;
+
+
+// parse: Parses the text with a `Stream`, and destroys the parse tree.
+template<typename Grammar, typename Stream>
+bench::run parse(const std::string& text) {
+  Stream stream(text);
+  
+  auto r = Grammar::file(stream);
+  
+  bench::run run { 0, 0 };
+  for (const auto& line : *r)
+    for (const auto& cell : line) {
+      run.items++;
+      run.checksum += cell.size();
+    }
+  
+  return run;
+} // The parse tree and the stream are freed here.
+
+
+auto main(int argc, char** argv) -> int {
+  auto opts = bench::options::parse(argc, argv);
+  
+  const std::string line = "12345,abc,\"a quoted cell, with a comma\",a cell longer than the small buffer\n";
+  
+  std::string text;
+  while (text.size() + line.size() <= opts.size)
+    text += line;
+  
+  std::cout << bench::header("arena", opts);
+  
+  bool first = true;
+  auto add = [&](const char* name, bench::run (&parse)(const std::string&)) {
+    if (!opts.selected(name))
+      return;
+    
+    auto s = bench::measure(opts, [&]() { return parse(text); });
+    
+    std::cout << (first ? "\n" : ",\n")
+              << "    { \"name\": \"" << name << "\""
+              << ", \"bytes\": " << text.size()
+              << ", \"items\": " << s.result.items
+              << ",\n      \"tpc\": " << bench::json(s, text.size()) << " }";
+    
+    first = false;
+  };
+  
+  add("std", parse< csv<vector, std::string>, tpc::stream >);
+  add("pmr session", parse< csv<pmr_vector, std::pmr::string>, tpc::session >);
+  
+  std::cout << bench::footer();
+}
@@ -0,0 +1,304 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+// The harness of the benchmarks: options, corpus generation, timing, allocation counting
+// and JSON reports. Each benchmark is a program of a single translation unit, which
+// includes this file once, as it replaces the global operator new.
+
+#ifndef __TPC_BENCHMARKS_BENCH_HPP__
+#define __TPC_BENCHMARKS_BENCH_HPP__
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <tpc/parser/position.hpp>
+
+
+namespace bench {
+  // allocations: The count of calls to the global operator new.
+  inline std::atomic<std::size_t> allocations { 0 };
+}
+
+
+void* operator new(std::size_t size) {
+  bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  
+  if (void* p = std::malloc(size ? size : 1))
+    return p;
+  
+  throw std::bad_alloc();
+}
+
+// The deletes are not inlined, lest GCC warn about freeing with `std::free` the memory
+// it assumes was allocated by the standard `operator new` (-Wmismatched-new-delete).
+[[gnu::noinline]] void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) { // Used by std::pmr.
+  bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  
+  std::size_t alignment = static_cast<std::size_t>(align);
+  
+  if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment))
+    return p;
+  
+  throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+
+namespace bench {
+  // options: The command line of a benchmark, as `key=value` arguments:
+  // size=N:       Approximate size of each corpus, in bytes. Default: 4 MB.
+  // seed=N:       Seed of the corpus generator. The same seed makes the same corpora.
+  // dist=D:       Distribution of the lengths of the items in the corpora: `short`,
+  //               `long` or `mixed`, which spans both. Default: mixed.
+  // filter=S:     Runs only the benchmarks whose name contains S.
+  // runs=N:       Count of measurements of each benchmark, of which the fastest is
+  //               reported. Default: 5.
+  // min_time=S:   Least duration of a measurement, in seconds. The parse is repeated
+  //               until it is reached. Default: 0.1.
+  struct options {
+    std::size_t size = 4 * 1024 * 1024;
+    std::uint64_t seed = 1;
+    std::string dist = "mixed";
+    std::string filter;
+    int runs = 5;
+    double min_time = 0.1;
+    
+    
+    static options parse(int argc, char** argv) {
+      options opts;
+      
+      for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto eq = arg.find('=');
+        std::string key = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+        
+        if (key == "size")
+          opts.size = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "seed")
+          opts.seed = std::strtoull(value.c_str(), nullptr, 10);
+        else if (key == "dist" && (value == "short" || value == "long" || value == "mixed"))
+          opts.dist = value;
+        else if (key == "filter")
+          opts.filter = value;
+        else if (key == "runs")
+          opts.runs = std::max(1, std::atoi(value.c_str()));
+        else if (key == "min_time")
+          opts.min_time = std::atof(value.c_str());
+        else {
+          std::cerr << "unknown argument: " << arg << std::endl;
+          std::exit(2);
+        }
+      }
+      
+      return opts;
+    }
+    
+    // selected: Wether the benchmark `name` is to be run.
+    bool selected(const std::string& name) const {
+      return name.find(filter) != std::string::npos;
+    }
+  };
+  
+  
+  // random: A small deterministic generator (splitmix64), so that the corpora are the
+  // same on every standard library.
+  class random {
+  public:
+    explicit random(std::uint64_t seed) : state(seed)
+    { }
+    
+    std::uint64_t next() {
+      std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+    
+    // range: A number in [lo, hi].
+    std::size_t range(std::size_t lo, std::size_t hi) {
+      return lo + next() % (hi - lo + 1);
+    }
+    
+    // pick: A character of `chars`.
+    char pick(const char* chars) {
+      return chars[next() % std::strlen(chars)];
+    }
+  
+  private:
+    std::uint64_t state;
+  };
+  
+  // lengths: The range of the lengths of items for a distribution, given the ranges for
+  // short and for long items.
+  struct lengths {
+    std::size_t lo, hi;
+    
+    lengths(const options& opts, lengths shorter, lengths longer)
+    : lo(opts.dist == "long" ? longer.lo : shorter.lo),
+      hi(opts.dist == "short" ? shorter.hi : longer.hi)
+    { }
+    
+    lengths(std::size_t lo, std::size_t hi) : lo(lo), hi(hi)
+    { }
+  };
+  
+  
+  // keep: Prevents the compiler from optimizing away the computation of a value.
+  template<typename T>
+  inline void keep(const T& value) {
+    asm volatile("" : : "r"(&value) : "memory");
+  }
+  
+  
+  // run: What a measured function returns: the count of items parsed, and a checksum of
+  // their values, which must agree between a parser and its baseline.
+  struct run {
+    std::size_t items;
+    std::uint64_t checksum;
+  };
+  
+  // sample: The fastest measurement of a function.
+  struct sample {
+    run result;
+    double seconds;     // Per execution.
+    double allocations; // Per execution.
+  };
+  
+  // measure: Executes `f` repeatedly, in `opts.runs` measurements of at least
+  // `opts.min_time` seconds each, returning the fastest.
+  template<typename F>
+  sample measure(const options& opts, F&& f) {
+    sample best { f(), 0, 0 }; // Also warms up the caches.
+    best.seconds = 1e300;
+    
+    for (int i = 0; i < opts.runs; i++) {
+      std::size_t reps = 0;
+      std::size_t allocs = allocations.load();
+      auto start = std::chrono::steady_clock::now();
+      std::chrono::duration<double> elapsed { 0 };
+      
+      do {
+        run r = f();
+        keep(r);
+        reps++;
+        elapsed = std::chrono::steady_clock::now() - start;
+      } while (elapsed.count() < opts.min_time);
+      
+      double seconds = elapsed.count() / reps;
+      
+      if (seconds < best.seconds) {
+        best.seconds = seconds;
+        best.allocations = double(allocations.load() - allocs) / reps;
+      }
+    }
+    
+    return best;
+  }
+  
+  
+  // status: A field of /proc/self/status, in bytes, or 0 if it is unavailable (Linux only).
+  inline std::size_t status(const char* field) {
+    std::ifstream file("/proc/self/status");
+    std::string line;
+    
+    while (std::getline(file, line))
+      if (line.compare(0, std::strlen(field), field) == 0 && line[std::strlen(field)] == ':')
+        return std::strtoull(line.c_str() + std::strlen(field) + 1, nullptr, 10) * 1024;
+    
+    return 0;
+  }
+  
+  // rss: The resident set size of the process, in bytes.
+  inline std::size_t rss() {
+    return status("VmRSS");
+  }
+  
+  // peak_rss: The peak resident set size of the process, in bytes, since it started or
+  // since the last call to `reset_peak_rss`.
+  inline std::size_t peak_rss() {
+    return status("VmHWM");
+  }
+  
+  // reset_peak_rss: Resets the peak resident set size to the current one, on kernels that
+  // support it (Linux 4.0 or later).
+  inline void reset_peak_rss() {
+    std::ofstream("/proc/self/clear_refs") << "5";
+  }
+  
+  
+  // json: Formats a number for a JSON document.
+  inline std::string json(double value) {
+    std::ostringstream out;
+    out.precision(6);
+    out << value;
+    return out.str();
+  }
+  
+  // json: Formats a sample of a function that parsed `bytes` bytes, as a JSON object.
+  inline std::string json(const sample& s, std::size_t bytes) {
+    std::size_t items = std::max<std::size_t>(s.result.items, 1);
+    
+    return "{ \"mb_per_s\": " + json(bytes / s.seconds / 1e6)
+         + ", \"ns_per_item\": " + json(s.seconds * 1e9 / items)
+         + ", \"allocs_per_item\": " + json(s.allocations / items)
+         + " }";
+  }
+  
+  // header: The beginning of the JSON report of a benchmark program, with the options.
+  inline std::string header(const char* program, const options& opts) {
+#if TPC_POSITION == TPC_POSITION_LAZY
+    const char* position = "lazy";
+#elif TPC_POSITION == TPC_POSITION_NONE
+    const char* position = "none";
+#else
+    const char* position = "eager";
+#endif
+    
+    return std::string("{\n")
+         + "  \"program\": \"" + program + "\",\n"
+         + "  \"options\": { \"size\": " + std::to_string(opts.size)
+         + ", \"seed\": " + std::to_string(opts.seed)
+         + ", \"dist\": \"" + opts.dist + "\""
+         + ", \"runs\": " + std::to_string(opts.runs)
+         + ", \"min_time\": " + json(opts.min_time)
+         + ", \"position\": \"" + position + "\" },\n"
+         + "  \"benchmarks\": [";
+  }
+  
+  // footer: The end of the JSON report of a benchmark program.
+  inline std::string footer() {
+    return "\n  ]\n}\n";
+  }
+}
+
+
+#endif /* __TPC_BENCHMARKS_BENCH_HPP__ */
@@ -0,0 +1,560 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+// End-to-end benchmarks of the grammars of the examples: csv, lisp, roman and elements.
+// Each grammar parses a generated corpus from every input backend: a std::stringstream,
+// a std::ifstream, a contiguous string in memory, and a tpc::mapped_file. The corpora
+// are written to temporary files, which are removed at the end.
+//
+// Reports MB/s, ns/item, allocations/item and the growth of the peak resident set size
+// while parsing as JSON, on stdout. Every backend must agree with the string backend on
+// the count of items and on a checksum of their values.
+// Usage: grammars [size=N] [seed=N] [dist=short|long|mixed] [filter=S] [runs=N] [min_time=S]
+// See benchmarks/bench.hpp for the options. The filter applies to "grammar/backend".
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <tpc/util/traits.hpp>
+
+#include <tpc/parser/first.hpp>
+#include <tpc/parser/mapped_file.hpp>
+#include <tpc/parser/combinators/fold.hpp>
+#include <tpc/parser/combinators/join.hpp>
+#include <tpc/parser/combinators/keywords.hpp>
+#include <tpc/parser/combinators/lexeme.hpp>
+#include <tpc/parser/combinators/maybe.hpp>
+#include <tpc/parser/combinators/or.hpp>
+#include <tpc/parser/combinators/parens.hpp>
+#include <tpc/parser/combinators/sepby.hpp>
+#include <tpc/parser/combinators/sependby.hpp>
+#include <tpc/parser/combinators/sink.hpp>
+#include <tpc/parser/standard/char.hpp>
+#include <tpc/parser/standard/identifier.hpp>
+#include <tpc/parser/standard/number.hpp>
+#include <tpc/parser/standard/span.hpp>
+#include <tpc/parser/standard/string.hpp>
+
+#include "bench.hpp"
+
+
+using bench::run;
+
+
+// bits: The representation of a floating point value, for checksums.
+template<typename F>
+std::uint64_t bits(F value) {
+  std::uint64_t b = 0;
+  std::memcpy(&b, &value, sizeof(value));
+  return b;
+}
+
+// finish: Checks that a parser consumed the whole corpus.
+template<typename T>
+void finish(const char* grammar, const tpc::result<T>& r, tpc::stream& stream) {
+  if (!r || !tpc::eos(stream))
+    throw std::runtime_error(std::string(grammar) + ": the corpus was not parsed");
+}
+
+
+const char* const digits = "0123456789";
+const char* const alpha = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+const char* const alnum = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+
+// csv -----------------------------------------------------------------------------------
+
+// The grammar of examples/csv.cpp, with standard containers.
+namespace csv {
+  typedef std::vector<std::string> Line;
+  typedef std::vector<Line> CSV;
+  
+  constexpr bool isIdent(char c) {
+    return c >= ' ' && c <= '~' // Printable.
+        && c != tpc::Char::Comma
+        && c != tpc::Char::LineFeed
+        && c != tpc::Char::Carriage;
+  }
+  
+  constexpr tpc::parser<std::string> unquoted = tpc::span1<isIdent>;
+}
+
+// The FIRST sets of the cells, so that quoted strings are only attempted on a quote.
+template<>
+struct tpc::first_set<std::string, csv::unquoted> : tpc::First::predicate<csv::isIdent> { };
+
+namespace csv {
+  constexpr tpc::parser<std::string> cell = tpc::orP< std::string, tpc::string
+                                                                 , unquoted    >;
+  
+  constexpr tpc::parser<Line> line = tpc::sepBy1<char, tpc::comma, Line, cell>;
+  
+  constexpr tpc::parser<CSV> file = tpc::sepEndBy< tpc::void_t, tpc::newline,
+                                                   CSV,         line          >;
+  
+  
+  // corpus: Lines of numbers, unquoted text, and quoted text with commas and escapes.
+  std::string corpus(const bench::options& opts) {
+    bench::lengths fields(opts, { 3, 6 }, { 12, 32 });
+    bench::lengths len(opts, { 1, 8 }, { 16, 64 });
+    
+    bench::random rng(opts.seed);
+    std::string text;
+    
+    while (text.size() < opts.size) {
+      for (std::size_t i = rng.range(fields.lo, fields.hi); i > 0; i--) {
+        std::size_t n = rng.range(len.lo, len.hi);
+        
+        switch (rng.next() % 3) {
+          case 0:
+            while (n-- > 0)
+              text += rng.pick(digits);
+            break;
+          
+          case 1:
+            text += rng.pick(alpha);
+            while (n-- > 1)
+              text += rng.next() % 8 ? rng.pick(alnum) : ' ';
+            break;
+          
+          default:
+            text += '"';
+            while (n-- > 0) {
+              auto r = rng.next() % 16;
+              text += r == 0 ? "\\\"" : r == 1 ? "\\\\" : r < 4 ? "," : std::string(1, rng.pick(alnum));
+            }
+            text += '"';
+        }
+        
+        text += i > 1 ? ',' : '\n';
+      }
+    }
+    
+    return text;
+  }
+  
+  run parse(tpc::stream& stream) {
+    auto r = file(stream);
+    finish("csv", r, stream);
+    
+    run result { 0, 0 };
+    for (const auto& line : *r)
+      for (const auto& cell : line) {
+        result.items++;
+        result.checksum += cell.size() * 31 + (cell.empty() ? 0 : cell.back());
+      }
+    
+    return result;
+  }
+}
+
+
+// lisp ----------------------------------------------------------------------------------
+
+// The grammar of examples/lisp.cpp.
+namespace lisp {
+  template<typename N>
+  N operation(const char& o, const N& i, const N& j) {
+    switch (o) {
+      case '+': return i + j;
+      case '-': return i - j;
+      case '*': return i * j;
+      case '/': return i / j;
+      
+      default: return N();
+    }
+  }
+  
+  bool is_operator(char c) {
+    return c == '+'
+        || c == '-'
+        || c == '*'
+        || c == '/';
+  }
+  
+  template<typename N>
+  tpc::result<N> expression(tpc::stream&);
+  
+  template<typename N>
+  constexpr tpc::parser<N> literal = tpc::lexeme< N, tpc::number<N> >;
+  
+  template<typename N>
+  constexpr tpc::parser<N> expr = tpc::parens<
+    N, tpc::join< char, tpc::lexeme< char, tpc::character<is_operator> >,
+                  N,    expression<N>,
+                  N,    expression<N>,
+                  N,    operation<N> >
+  >;
+}
+
+// The FIRST sets of the alternatives, so that only one of them is attempted.
+template<typename N, tpc::parser<N> p>
+struct tpc::first_set<N, p, std::void_t< tpc::Util::Traits::is_number<N>,
+                                         tpc::First::rule<N, p, lisp::literal<N>> >>
+  : tpc::first_set<N, tpc::number<N>> { };
+
+template<typename N, tpc::parser<N> p>
+struct tpc::first_set<N, p, std::void_t< tpc::Util::Traits::is_number<N>,
+                                         tpc::First::rule<N, p, lisp::expr<N>> >>
+  : tpc::First::predicate< tpc::Char::is<tpc::Char::OpenParen> > { };
+
+namespace lisp {
+  template<typename N>
+  tpc::result<N> expression(tpc::stream& stream) {
+    return tpc::orP< N, literal<N>
+                      , expr<N>    >(stream);
+  }
+  
+  
+  // expression: An expression nested `depth` levels deep. One operand of each level is
+  // the next level, and the other is a shallow expression, so that the size is linear
+  // in the depth.
+  void expression(bench::random& rng, std::size_t depth, std::string& text) {
+    if (depth == 0) {
+      text += std::to_string(rng.range(1, 99));
+      return;
+    }
+    
+    text += '(';
+    text += "+-*/"[rng.next() % 4];
+    text += ' ';
+    
+    bool left = rng.next() % 2;
+    
+    expression(rng, left ? depth - 1 : rng.range(0, 1), text);
+    text += ' ';
+    expression(rng, left ? rng.range(0, 1) : depth - 1, text);
+    
+    text += ')';
+  }
+  
+  // corpus: Expressions separated by spaces.
+  std::string corpus(const bench::options& opts) {
+    bench::lengths depth(opts, { 1, 4 }, { 64, 256 });
+    
+    bench::random rng(opts.seed);
+    std::string text;
+    
+    while (text.size() < opts.size) {
+      if (!text.empty())
+        text += ' ';
+      
+      expression(rng, rng.range(depth.lo, depth.hi), text);
+    }
+    
+    return text;
+  }
+  
+  run parse(tpc::stream& stream) {
+    run result { 0, 0 };
+    
+    auto r = tpc::each< double, expression<double> >(
+      [&](double value) { result.checksum += bits(value); },
+      stream
+    );
+    finish("lisp", r, stream);
+    
+    result.items = *r;
+    return result;
+  }
+}
+
+
+// roman ---------------------------------------------------------------------------------
+
+// The grammar of examples/roman.cpp.
+namespace roman {
+  int sum(int x, int y) { return x + y; }
+  
+  constexpr char i[]  = "I",  iv[] = "IV", v[]  = "V",  ix[] = "IX", x[]  = "X"
+           , xl[] = "XL", l[]  = "L",  xc[] = "XC", c[]  = "C"
+           , cd[] = "CD", d[]  = "D",  cm[] = "CM", m[]  = "M";
+  
+  
+  template<const char* dig, int value>
+  using digit = tpc::keyword<dig, value>;
+  
+  constexpr tpc::parser<int> unity = tpc::keywords<
+    int, digit<m, 1000>, digit<cm, 900>, digit<d, 500>, digit<cd, 400>, digit<c, 100>
+       , digit<xc, 90>, digit<l, 50>, digit<xl, 40>, digit<x, 10>, digit<ix, 9>
+       , digit<v, 5>, digit<iv, 4>, digit<i, 1>
+  >;
+  
+  constexpr tpc::parser<int> numeral = tpc::fold1<int, unity, sum>;
+  
+  
+  // corpus: Numerals separated by spaces.
+  std::string corpus(const bench::options& opts) {
+    static const int values[] = { 1000, 900, 500, 400, 100, 90, 50, 40, 10, 9, 5, 4, 1 };
+    static const char* const symbols[] = {
+      m, cm, d, cd, c, xc, l, xl, x, ix, v, iv, i
+    };
+    
+    bench::lengths range(opts, { 1, 50 }, { 1000, 3999 });
+    
+    bench::random rng(opts.seed);
+    std::string text;
+    
+    while (text.size() < opts.size) {
+      if (!text.empty())
+        text += ' ';
+      
+      int n = rng.range(range.lo, range.hi);
+      
+      for (int k = 0; n > 0; k++)
+        for (; n >= values[k]; n -= values[k])
+          text += symbols[k];
+    }
+    
+    return text;
+  }
+  
+  run parse(tpc::stream& stream) {
+    run result { 0, 0 };
+    
+    auto r = tpc::each< int, tpc::lexeme<int, numeral> >(
+      [&](int value) { result.checksum += value; },
+      stream
+    );
+    finish("roman", r, stream);
+    
+    result.items = *r;
+    return result;
+  }
+}
+
+
+// elements ------------------------------------------------------------------------------
+
+// The grammar of examples/elements.cpp.
+namespace elements {
+  bool islower(char c) { return std::islower(c); }
+  bool isupper(char c) { return std::isupper(c); }
+  
+  float sum(float x, float y) { return x + y; }
+  
+  float weight(const std::string& element, const unsigned& count) {
+    if (element == "O")  return 15.9994 * count;
+    if (element == "H")  return 1.00794 * count;
+    if (element == "Na") return 22.9897 * count;
+    if (element == "Cl") return 35.4527 * count;
+    if (element == "C")  return 12.0107 * count;
+    if (element == "S")  return 32.0655 * count;
+    
+    return -1;
+  }
+  
+  
+  constexpr tpc::parser<std::string> element = tpc::identifier<isupper, islower>;
+  
+  constexpr tpc::parser<unsigned> count = tpc::number<unsigned>;
+  
+  constexpr tpc::parser<float> formula = tpc::fold1<
+    float, tpc::join< std::string, element,
+                      unsigned,    tpc::maybe<unsigned, 1, count>,
+                      float,       weight                           >,
+           sum
+  >;
+  
+  
+  // corpus: Formulas separated by spaces.
+  std::string corpus(const bench::options& opts) {
+    static const char* const symbols[] = { "O", "H", "Na", "Cl", "C", "S" };
+    
+    bench::lengths len(opts, { 1, 4 }, { 32, 128 });
+    
+    bench::random rng(opts.seed);
+    std::string text;
+    
+    while (text.size() < opts.size) {
+      if (!text.empty())
+        text += ' ';
+      
+      for (std::size_t n = rng.range(len.lo, len.hi); n > 0; n--) {
+        text += symbols[rng.next() % 6];
+        
+        if (rng.next() % 2)
+          text += std::to_string(rng.range(2, 20));
+      }
+    }
+    
+    return text;
+  }
+  
+  run parse(tpc::stream& stream) {
+    run result { 0, 0 };
+    
+    auto r = tpc::each< float, tpc::lexeme<float, formula> >(
+      [&](float value) { result.checksum += bits(value); },
+      stream
+    );
+    finish("elements", r, stream);
+    
+    result.items = *r;
+    return result;
+  }
+}
+
+
+// Driver --------------------------------------------------------------------------------
+
+struct grammar {
+  const char* name;
+  std::string (&corpus)(const bench::options&);
+  run (&parse)(tpc::stream&);
+};
+
+const grammar grammars[] = {
+  { "csv",      csv::corpus,      csv::parse      },
+  { "lisp",     lisp::corpus,     lisp::parse     },
+  { "roman",    roman::corpus,    roman::parse    },
+  { "elements", elements::corpus, elements::parse },
+};
+
+
+const char* const backends[] = { "stringstream", "ifstream", "string", "mapped_file" };
+
+
+class driver {
+public:
+  explicit driver(const bench::options& opts) : opts(opts), first(true), agree(true) {
+    std::cout << bench::header("grammars", opts);
+  }
+  
+  ~driver() {
+    std::cout << bench::footer();
+  }
+  
+  // add: Measures a grammar over a corpus, from every backend.
+  void add(const grammar& g) {
+    std::string prefix = std::string(g.name) + "/";
+    
+    bool selected = false;
+    for (const char* backend : backends)
+      selected = selected || opts.selected(prefix + backend);
+    
+    if (!selected)
+      return;
+    
+    std::string text = g.corpus(opts);
+    std::string path = std::filesystem::temp_directory_path() / ("tpc-" + std::string(g.name));
+    
+    std::ofstream(path, std::ios::binary).write(text.data(), text.size());
+    
+    {
+      tpc::stream stream(text);
+      reference = g.parse(stream); // Also warms up the caches.
+    }
+    
+    measure(prefix + "stringstream", text, [&]() {
+      std::istringstream in(text);
+      
+      return [&, in = std::move(in)]() mutable {
+        in.clear();
+        in.seekg(0);
+        
+        tpc::stream stream(in);
+        return g.parse(stream);
+      };
+    });
+    
+    measure(prefix + "ifstream", text, [&]() {
+      return [&]() {
+        std::ifstream in(path, std::ios::binary);
+        
+        tpc::stream stream(in);
+        return g.parse(stream);
+      };
+    });
+    
+    measure(prefix + "string", text, [&]() {
+      return [&]() {
+        tpc::stream stream(text);
+        return g.parse(stream);
+      };
+    });
+    
+    measure(prefix + "mapped_file", text, [&]() {
+      return [&]() {
+        tpc::mapped_file file(path);
+        
+        tpc::stream stream(file);
+        return g.parse(stream);
+      };
+    });
+    
+    std::remove(path.c_str());
+  }
+  
+  // ok: Wether every backend agreed with the string backend.
+  bool ok() const { return agree; }
+
+private:
+  const bench::options& opts;
+  bool first;
+  bool agree;
+  
+  run reference; // The result of the string backend.
+  
+  
+  // measure: Measures a parse made by `setup`, which is called within the measurement of
+  // the peak resident set size, so that the memory of the backend counts.
+  template<typename Setup>
+  void measure(const std::string& name, const std::string& text, Setup setup) {
+    if (!opts.selected(name))
+      return;
+    
+    std::size_t rss = bench::rss();
+    bench::reset_peak_rss();
+    
+    auto s = bench::measure(opts, setup());
+    
+    std::size_t peak = bench::peak_rss();
+    
+    bool same = s.result.items == reference.items && s.result.checksum == reference.checksum;
+    agree = agree && same;
+    
+    std::cout << (first ? "\n" : ",\n")
+              << "    { \"name\": \"" << name << "\""
+              << ", \"bytes\": " << text.size()
+              << ", \"items\": " << s.result.items
+              << ",\n      \"tpc\": " << bench::json(s, text.size())
+              << ",\n      \"peak_rss_mb\": " << bench::json((peak > rss ? peak - rss : 0) / 1e6)
+              << ", \"agree\": " << (same ? "true" : "false") << " }";
+    
+    first = false;
+  }
+};
+
+
+auto main(int argc, char** argv) -> int {
+  auto opts = bench::options::parse(argc, argv);
+  
+  bool ok;
+  try {
+    driver d(opts);
+    
+    for (const auto& g : grammars)
+      d.add(g);
+    
+    ok = d.ok();
+  }
+  catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  }
+  
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,664 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+// Microbenchmarks of the standard parsers and of the main combinators.
+// Each benchmark parses a generated corpus with a TPC parser, and with a hand-written
+// loop that produces the same values, the baseline. The ratio of their times, the
+// penalty, is the cost of the abstraction. Both must agree on a checksum of the values.
+//
+// Reports MB/s, ns/item and allocations/item as JSON, on stdout.
+// Usage: micro [size=N] [seed=N] [dist=short|long|mixed] [filter=S] [runs=N] [min_time=S]
+// See benchmarks/bench.hpp for the options.
+
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <tpc/parser/first.hpp>
+#include <tpc/parser/combinators/fold.hpp>
+#include <tpc/parser/combinators/lexeme.hpp>
+#include <tpc/parser/combinators/many.hpp>
+#include <tpc/parser/combinators/map.hpp>
+#include <tpc/parser/combinators/or.hpp>
+#include <tpc/parser/combinators/reserved.hpp>
+#include <tpc/parser/combinators/sepby.hpp>
+#include <tpc/parser/standard/char.hpp>
+#include <tpc/parser/standard/floating.hpp>
+#include <tpc/parser/standard/identifier.hpp>
+#include <tpc/parser/standard/integral.hpp>
+#include <tpc/parser/standard/span.hpp>
+#include <tpc/parser/standard/string.hpp>
+
+#include "bench.hpp"
+
+
+using bench::run;
+
+
+// Corpora -------------------------------------------------------------------------------
+
+const char* const digits = "0123456789";
+const char* const alpha = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+const char* const alnum = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+const char* const keywords[] = {
+  "if", "else", "while", "for", "return", "break", "continue", "switch"
+};
+
+// separator: A space. Newlines are not whitespace for `lexeme`.
+void separator(bench::random&, std::string& text) {
+  text += ' ';
+}
+
+void integer(bench::random& rng, const bench::lengths& len, std::string& text) {
+  if (rng.next() % 4 == 0)
+    text += '-';
+  
+  text += digits[rng.range(1, 9)];
+  
+  for (std::size_t i = rng.range(len.lo, len.hi); i > 1; i--)
+    text += rng.pick(digits);
+}
+
+void identifier(bench::random& rng, const bench::lengths& len, std::string& text) {
+  text += rng.pick(alpha);
+  
+  for (std::size_t i = rng.range(len.lo, len.hi); i > 1; i--)
+    text += rng.pick(alnum);
+}
+
+void quoted(bench::random& rng, const bench::lengths& len, std::string& text) {
+  text += '"';
+  
+  for (std::size_t i = rng.range(len.lo, len.hi); i > 0; i--) {
+    if (rng.next() % 16 == 0)
+      text += rng.next() % 2 ? "\\\"" : "\\\\";
+    else
+      text += rng.next() % 8 ? rng.pick(alnum) : ' ';
+  }
+  
+  text += '"';
+}
+
+
+// corpus: Generates items with `item`, separated by `sep`, up to the size in the options.
+template<typename Item, typename Sep>
+std::string corpus(const bench::options& opts, Item item, Sep sep) {
+  bench::random rng(opts.seed);
+  std::string text;
+  
+  while (text.size() < opts.size) {
+    if (!text.empty())
+      sep(rng, text);
+    
+    item(rng, text);
+  }
+  
+  return text;
+}
+
+std::string integers(const bench::options& opts) {
+  bench::lengths len(opts, { 1, 3 }, { 10, 18 });
+  
+  return corpus(
+    opts,
+    [&](bench::random& rng, std::string& text) { integer(rng, len, text); },
+    separator
+  );
+}
+
+std::string floats(const bench::options& opts) {
+  bench::lengths len(opts, { 1, 4 }, { 10, 16 });
+  
+  return corpus(
+    opts,
+    [&](bench::random& rng, std::string& text) {
+      integer(rng, { 1, 3 }, text);
+      text += '.';
+      
+      for (std::size_t i = rng.range(len.lo, len.hi); i > 0; i--)
+        text += rng.pick(digits);
+      
+      if (rng.next() % 4 == 0)
+        text += "e-" + std::to_string(rng.range(1, 30));
+    },
+    separator
+  );
+}
+
+std::string identifiers(const bench::options& opts) {
+  bench::lengths len(opts, { 1, 6 }, { 12, 40 });
+  
+  return corpus(
+    opts,
+    [&](bench::random& rng, std::string& text) { identifier(rng, len, text); },
+    separator
+  );
+}
+
+std::string strings(const bench::options& opts) {
+  bench::lengths len(opts, { 0, 8 }, { 20, 80 });
+  
+  return corpus(
+    opts,
+    [&](bench::random& rng, std::string& text) { quoted(rng, len, text); },
+    separator
+  );
+}
+
+std::string words(const bench::options& opts) {
+  bench::lengths spaces(opts, { 1, 1 }, { 2, 16 });
+  
+  return corpus(
+    opts,
+    [](bench::random& rng, std::string& text) {
+      for (std::size_t i = rng.range(1, 4); i > 0; i--)
+        text += rng.pick(alpha);
+    },
+    [&](bench::random& rng, std::string& text) {
+      for (std::size_t i = rng.range(spaces.lo, spaces.hi); i > 0; i--)
+        text += rng.pick(" \t");
+    }
+  );
+}
+
+std::string reserved(const bench::options& opts) {
+  return corpus(
+    opts,
+    [](bench::random& rng, std::string& text) { text += keywords[rng.next() % 8]; },
+    separator
+  );
+}
+
+std::string tokens(const bench::options& opts) {
+  bench::lengths ints(opts, { 1, 3 }, { 10, 18 });
+  bench::lengths idents(opts, { 1, 6 }, { 12, 40 });
+  bench::lengths strs(opts, { 0, 8 }, { 20, 80 });
+  
+  return corpus(
+    opts,
+    [&](bench::random& rng, std::string& text) {
+      switch (rng.next() % 3) {
+        case 0:  integer(rng, ints, text);      break;
+        case 1:  identifier(rng, idents, text); break;
+        default: quoted(rng, strs, text);       break;
+      }
+    },
+    separator
+  );
+}
+
+std::string list(const bench::options& opts) {
+  bench::lengths len(opts, { 1, 3 }, { 10, 18 });
+  
+  return corpus(
+    opts,
+    [&](bench::random& rng, std::string& text) { integer(rng, len, text); },
+    [](bench::random&, std::string& text) { text += ','; }
+  );
+}
+
+
+// Parsers -------------------------------------------------------------------------------
+
+constexpr tpc::parser<long> integerP = tpc::lexeme<long, tpc::integral<long>>;
+
+constexpr tpc::parser<double> floatP = tpc::lexeme<double, tpc::floating<double>>;
+
+constexpr tpc::parser<std::string> identifierP =
+  tpc::lexeme< std::string, tpc::identifier<tpc::Char::isAlpha, tpc::Char::isAlphaNum> >;
+
+constexpr tpc::parser<std::string> stringP = tpc::lexeme<std::string, tpc::string>;
+
+constexpr char k_if[] = "if", k_else[] = "else", k_while[] = "while", k_for[] = "for",
+               k_return[] = "return", k_break[] = "break", k_continue[] = "continue",
+               k_switch[] = "switch";
+
+// startsWith<kw>: Wether `c` is the first character of `kw`.
+template<const char* keyword>
+constexpr bool startsWith(char c) {
+  return c == keyword[0];
+}
+
+// The FIRST sets of the keywords and tokens, so that `orP` only attempts those that may
+// start with the next character.
+template<const char* keyword>
+struct reservedFirst : tpc::First::predicate< startsWith<keyword> > { };
+
+template<> struct tpc::first_set<std::string, tpc::reserved<k_if>> : reservedFirst<k_if> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_else>> : reservedFirst<k_else> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_while>> : reservedFirst<k_while> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_for>> : reservedFirst<k_for> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_return>> : reservedFirst<k_return> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_break>> : reservedFirst<k_break> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_continue>> : reservedFirst<k_continue> { };
+template<> struct tpc::first_set<std::string, tpc::reserved<k_switch>> : reservedFirst<k_switch> { };
+
+constexpr tpc::parser<std::string> keywordP =
+  tpc::lexeme< std::string, tpc::orP< std::string, tpc::reserved<k_if>,
+                                                   tpc::reserved<k_else>,
+                                                   tpc::reserved<k_while>,
+                                                   tpc::reserved<k_for>,
+                                                   tpc::reserved<k_return>,
+                                                   tpc::reserved<k_break>,
+                                                   tpc::reserved<k_continue>,
+                                                   tpc::reserved<k_switch> > >;
+
+std::size_t fromLong(long value) { return value; }
+std::size_t length(const std::string& str) { return str.size(); }
+
+constexpr tpc::parser<std::size_t> integerToken =
+  tpc::map<long, tpc::integral<long>, std::size_t, fromLong>;
+
+constexpr tpc::parser<std::size_t> identifierToken =
+  tpc::map< std::string, tpc::identifier<tpc::Char::isAlpha, tpc::Char::isAlphaNum>,
+            std::size_t, length                                                     >;
+
+constexpr tpc::parser<std::size_t> stringToken =
+  tpc::map<std::string, tpc::string, std::size_t, length>;
+
+template<> struct tpc::first_set<std::size_t, integerToken> {
+  static constexpr tpc::First::set value = tpc::Integral::first;
+};
+template<> struct tpc::first_set<std::size_t, identifierToken>
+  : tpc::First::predicate<tpc::Char::isAlpha> { };
+template<> struct tpc::first_set<std::size_t, stringToken>
+  : tpc::First::predicate< tpc::Char::is<tpc::Char::DoubleQuote> > { };
+
+constexpr tpc::parser<std::size_t> tokenP =
+  tpc::lexeme< std::size_t, tpc::orP<std::size_t, integerToken, identifierToken, stringToken> >;
+
+constexpr tpc::parser< std::vector<long> > manyP = tpc::many<std::vector<long>, integerP>;
+
+constexpr tpc::parser< std::vector<long> > sepByP =
+  tpc::sepBy< char, tpc::comma, std::vector<long>, tpc::integral<long> >;
+
+run none() { return run { 0, 0 }; }
+void accumulate(run& r, long value) { r.items++; r.checksum += value; }
+
+constexpr tpc::parser<run> foldP = tpc::fold<long, integerP, run, none, accumulate>;
+
+
+// Baselines -----------------------------------------------------------------------------
+
+bool space(char c) {
+  return c == ' ' || c == '\t' || c == '\v' || c == '\f';
+}
+
+const char* skipSpaces(const char* it, const char* end) {
+  while (it != end && space(*it))
+    it++;
+  
+  return it;
+}
+
+const char* parseLong(const char* it, const char* end, long& value) {
+  bool negative = it != end && *it == '-';
+  if (negative)
+    it++;
+  
+  value = 0;
+  while (it != end && std::isdigit(static_cast<unsigned char>(*it)))
+    value = value * 10 + (*it++ - '0');
+  
+  if (negative)
+    value = -value;
+  
+  return it;
+}
+
+const char* parseIdentifier(const char* it, const char* end, std::string& value) {
+  const char* begin = it;
+  
+  while (it != end && std::isalnum(static_cast<unsigned char>(*it)))
+    it++;
+  
+  value.assign(begin, it);
+  return it;
+}
+
+const char* parseString(const char* it, const char* end, std::string& value) {
+  value.clear();
+  it++; // Opening quote.
+  
+  while (it != end && *it != '"') {
+    const char* run = it;
+    
+    while (it != end && *it != '"' && *it != '\\')
+      it++;
+    
+    value.append(run, it);
+    
+    if (it != end && *it == '\\') {
+      value += it[1];
+      it += 2;
+    }
+  }
+  
+  return it + 1; // Closing quote.
+}
+
+
+// Benchmarks ----------------------------------------------------------------------------
+
+// checksum: Combines a string into a checksum.
+std::uint64_t checksum(const std::string& str) {
+  return str.size() * 31 + (str.empty() ? 0 : str.back());
+}
+
+// loop: Executes a parser until it fails, accumulating the checksums of the values.
+template<typename T, tpc::parser<T> p, typename Sum>
+run loop(const std::string& text, Sum sum) {
+  tpc::stream stream(text);
+  run r { 0, 0 };
+  
+  while (auto value = p(stream)) {
+    r.items++;
+    r.checksum += sum(*value);
+  }
+  
+  return r;
+}
+
+// scan: Executes a hand-written parser until the end of the text, accumulating the
+// checksums of the values.
+template<typename T, typename Parse, typename Sum>
+run scan(const std::string& text, Parse parse, Sum sum) {
+  const char* it = text.data();
+  const char* end = it + text.size();
+  run r { 0, 0 };
+  
+  while (it != end) {
+    T value { }; // A new value for each item, as parsers produce.
+    it = skipSpaces(parse(it, end, value), end);
+    r.items++;
+    r.checksum += sum(value);
+  }
+  
+  return r;
+}
+
+std::uint64_t bits(double value) {
+  std::uint64_t b;
+  std::memcpy(&b, &value, sizeof(b));
+  return b;
+}
+
+
+// suite: Runs the benchmarks, and prints the JSON report.
+class suite {
+public:
+  explicit suite(const bench::options& opts) : opts(opts), first(true), agree(true) {
+    std::cout << bench::header("micro", opts);
+  }
+  
+  ~suite() {
+    std::cout << bench::footer();
+  }
+  
+  // add: Measures a parser against its baseline, on a corpus.
+  template<typename Parser, typename Baseline>
+  void add(const char* name, const std::string& text, Parser tpc, Baseline baseline) {
+    if (!opts.selected(name))
+      return;
+    
+    auto p = bench::measure(opts, [&]() { return tpc(text); });
+    auto b = bench::measure(opts, [&]() { return baseline(text); });
+    
+    bool same = p.result.items == b.result.items && p.result.checksum == b.result.checksum;
+    agree = agree && same;
+    
+    std::cout << (first ? "\n" : ",\n")
+              << "    { \"name\": \"" << name << "\""
+              << ", \"bytes\": " << text.size()
+              << ", \"items\": " << p.result.items
+              << ",\n      \"tpc\": " << bench::json(p, text.size())
+              << ",\n      \"baseline\": " << bench::json(b, text.size())
+              << ",\n      \"penalty\": " << bench::json(p.seconds / b.seconds)
+              << ", \"agree\": " << (same ? "true" : "false") << " }";
+    
+    first = false;
+  }
+  
+  // ok: Wether every parser agreed with its baseline.
+  bool ok() const { return agree; }
+
+private:
+  const bench::options& opts;
+  bool first;
+  bool agree;
+};
+
+
+auto main(int argc, char** argv) -> int {
+  auto opts = bench::options::parse(argc, argv);
+  
+  auto ints = integers(opts);
+  auto ids = identifiers(opts);
+  auto toks = tokens(opts);
+  
+  bool ok;
+  {
+    suite s(opts);
+    
+    s.add(
+      "integral", ints,
+      [](const std::string& text) {
+        return loop<long, integerP>(text, [](long v) { return std::uint64_t(v); });
+      },
+      [](const std::string& text) {
+        return scan<long>(text, parseLong, [](long v) { return std::uint64_t(v); });
+      }
+    );
+    
+    s.add(
+      "floating", floats(opts),
+      [](const std::string& text) { return loop<double, floatP>(text, bits); },
+      [](const std::string& text) {
+        return scan<double>(
+          text,
+          [](const char* it, const char* end, double& value) {
+            return std::from_chars(it, end, value).ptr;
+          },
+          bits
+        );
+      }
+    );
+    
+    s.add(
+      "identifier", ids,
+      [](const std::string& text) { return loop<std::string, identifierP>(text, checksum); },
+      [](const std::string& text) { return scan<std::string>(text, parseIdentifier, checksum); }
+    );
+    
+    s.add(
+      "string", strings(opts),
+      [](const std::string& text) { return loop<std::string, stringP>(text, checksum); },
+      [](const std::string& text) { return scan<std::string>(text, parseString, checksum); }
+    );
+    
+    s.add(
+      "whitespace", words(opts),
+      [](const std::string& text) {
+        tpc::stream stream(text);
+        run r { 0, 0 };
+        
+        while (tpc::skipSpan1<tpc::Char::isAlpha>(stream)) {
+          r.items++;
+          tpc::whitespace(stream);
+        }
+        
+        r.checksum = stream.tellg();
+        return r;
+      },
+      [](const std::string& text) {
+        const char* it = text.data();
+        const char* end = it + text.size();
+        run r { 0, 0 };
+        
+        while (it != end && std::isalpha(static_cast<unsigned char>(*it))) {
+          r.items++;
+          
+          while (it != end && std::isalpha(static_cast<unsigned char>(*it)))
+            it++;
+          
+          it = skipSpaces(it, end);
+        }
+        
+        r.checksum = it - text.data();
+        return r;
+      }
+    );
+    
+    s.add(
+      "reserved", reserved(opts),
+      [](const std::string& text) { return loop<std::string, keywordP>(text, checksum); },
+      [](const std::string& text) {
+        return scan<std::string>(
+          text,
+          [](const char* it, const char* end, std::string& value) {
+            for (const char* keyword : keywords) {
+              std::size_t size = std::strlen(keyword);
+              
+              if (std::size_t(end - it) >= size && std::memcmp(it, keyword, size) == 0) {
+                value = keyword;
+                return it + size;
+              }
+            }
+            
+            return end;
+          },
+          checksum
+        );
+      }
+    );
+    
+    s.add(
+      "orP", toks,
+      [](const std::string& text) {
+        return loop<std::size_t, tokenP>(text, [](std::size_t v) { return v; });
+      },
+      [](const std::string& text) {
+        return scan<std::size_t>(
+          text,
+          [](const char* it, const char* end, std::size_t& value) {
+            std::string str;
+            
+            if (*it == '"')
+              it = parseString(it, end, str);
+            else if (std::isalpha(static_cast<unsigned char>(*it)))
+              it = parseIdentifier(it, end, str);
+            else {
+              long v;
+              it = parseLong(it, end, v);
+              value = v;
+              return it;
+            }
+            
+            value = str.size();
+            return it;
+          },
+          [](std::size_t v) { return v; }
+        );
+      }
+    );
+    
+    s.add(
+      "many", ints,
+      [](const std::string& text) {
+        tpc::stream stream(text);
+        auto r = manyP(stream);
+        
+        std::uint64_t sum = 0;
+        for (long v : *r)
+          sum += v;
+        
+        return run { r->size(), sum };
+      },
+      [](const std::string& text) {
+        const char* it = text.data();
+        const char* end = it + text.size();
+        std::vector<long> values;
+        
+        while (it != end) {
+          long v;
+          it = skipSpaces(parseLong(it, end, v), end);
+          values.push_back(v);
+        }
+        
+        std::uint64_t sum = 0;
+        for (long v : values)
+          sum += v;
+        
+        return run { values.size(), sum };
+      }
+    );
+    
+    s.add(
+      "sepBy", list(opts),
+      [](const std::string& text) {
+        tpc::stream stream(text);
+        auto r = sepByP(stream);
+        
+        std::uint64_t sum = 0;
+        for (long v : *r)
+          sum += v;
+        
+        return run { r->size(), sum };
+      },
+      [](const std::string& text) {
+        const char* it = text.data();
+        const char* end = it + text.size();
+        std::vector<long> values;
+        
+        while (it != end) {
+          long v;
+          it = parseLong(it, end, v);
+          values.push_back(v);
+          
+          if (it != end)
+            it++; // Comma.
+        }
+        
+        std::uint64_t sum = 0;
+        for (long v : values)
+          sum += v;
+        
+        return run { values.size(), sum };
+      }
+    );
+    
+    s.add(
+      "fold", ints,
+      [](const std::string& text) {
+        tpc::stream stream(text);
+        return *foldP(stream);
+      },
+      [](const std::string& text) {
+        const char* it = text.data();
+        const char* end = it + text.size();
+        run r { 0, 0 };
+        
+        while (it != end) {
+          long v;
+          it = skipSpaces(parseLong(it, end, v), end);
+          r.items++;
+          r.checksum += v;
+        }
+        
+        return r;
+      }
+    );
+    
+    ok = s.ok();
+  }
+  
+  return ok ? 0 : 1;
+}
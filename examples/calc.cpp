@@ -0,0 +1,82 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include <tpc/parser/first.hpp>
+#include <tpc/parser/combinators/expression.hpp>
+#include <tpc/parser/combinators/input.hpp>
+#include <tpc/parser/combinators/lexeme.hpp>
+#include <tpc/parser/combinators/or.hpp>
+#include <tpc/parser/combinators/parens.hpp>
+#include <tpc/parser/standard/number.hpp>
+
+
+namespace calc {
+  namespace util {
+    double add(double x, double y) { return x + y; }
+    double sub(double x, double y) { return x - y; }
+    double mul(double x, double y) { return x * y; }
+    double div(double x, double y) { return x / y; }
+    double pow(double x, double y) { return std::pow(x, y); }
+    double neg(double x)           { return -x; }
+  }
+  
+  constexpr char plus[] = "+", minus[] = "-", times[] = "*", over[] = "/", power[] = "^";
+  
+  
+  tpc::result<double> expr(tpc::stream&);
+  
+  constexpr tpc::parser<double> literal = tpc::lexeme< double, tpc::number<double> >;
+  constexpr tpc::parser<double> group   = tpc::parens<double, expr>;
+}
+
+
+// The FIRST sets of the atoms, so that only one of them is attempted.
+template<>
+struct tpc::first_set<double, calc::literal> : tpc::first_set< double, tpc::number<double> > { };
+
+template<>
+struct tpc::first_set<double, calc::group>
+  : tpc::First::predicate< tpc::Char::is<tpc::Char::OpenParen> > { };
+
+
+namespace calc {
+  constexpr tpc::parser<double> atom = tpc::orP<double, literal, group>;
+  
+  tpc::result<double> expr(tpc::stream& stream) {
+    return tpc::expression<
+      double, atom,
+      tpc::infixl<plus,  1, util::add>,
+      tpc::infixl<minus, 1, util::sub>,
+      tpc::infixl<times, 2, util::mul>,
+      tpc::infixl<over,  2, util::div>,
+      tpc::prefix<minus, 3, util::neg>,
+      tpc::infixr<power, 4, util::pow>
+    >(stream);
+  }
+}
+
+
+auto main() -> int {
+  std::string str;
+  
+  std::getline(std::cin, str);
+  
+  tpc::stream stream(str);
+  
+  
+  // Test with the expression: 2 * (3 + 4) - 2 ^ 3 ^ 2 / -64
+  auto r = tpc::input<double, calc::expr>(stream);
+  
+  
+  if (r)
+    std::cout << "result: " << *r << std::endl;
+  else
+    std::cout << "failed!" << std::endl;
+}
@@ -4,35 +4,45 @@
 // This software may be modified and distributed under the terms
 // of the BSD license. See the LICENSE file for details.
 
-#include <cctype>
-#include <fstream>
 #include <iostream>
+#include <memory_resource>
 #include <string>
 #include <vector>
 
 #include <tpc/util/string.hpp>
 
+#include <tpc/parser/mapped_file.hpp>
+#include <tpc/parser/first.hpp>
+#include <tpc/parser/session.hpp>
 #include <tpc/parser/combinators/or.hpp>
 #include <tpc/parser/combinators/sepby.hpp>
 #include <tpc/parser/combinators/sependby.hpp>
 #include <tpc/parser/standard/char.hpp>
-#include <tpc/parser/standard/identifier.hpp>
+#include <tpc/parser/standard/span.hpp>
 #include <tpc/parser/standard/string.hpp>
 
 
-typedef std::vector<std::string> Line;
-typedef std::vector<Line> CSV;
+// The cells and lines are allocated in the arena of a tpc::session.
+typedef std::pmr::vector<std::pmr::string> Line;
+typedef std::pmr::vector<Line> CSV;
 
 
-bool isIdent(char c) {
-  return std::isprint(c)
+constexpr bool isIdent(char c) {
+  return c >= ' ' && c <= '~' // Printable.
       && c != tpc::Char::Comma
       && c != tpc::Char::LineFeed
       && c != tpc::Char::Carriage;
 }
 
-constexpr tpc::parser<std::string> cell = tpc::orP<std::string, tpc::string
-                                                              , tpc::identifier<isIdent> >;
+constexpr tpc::parser<std::pmr::string> unquoted = tpc::span1<std::pmr::string, isIdent>;
+
+// The FIRST set of the unquoted cells. That of the quoted ones is declared by TPC.
+template<>
+struct tpc::first_set<std::pmr::string, unquoted> : tpc::First::predicate<isIdent> { };
+
+constexpr tpc::parser<std::pmr::string> cell =
+  tpc::orP< std::pmr::string, tpc::string<std::pmr::string>
+                            , unquoted                      >;
 
 constexpr tpc::parser<Line> line = tpc::sepBy1<char, tpc::comma, // No empty lines allowed.
                                                Line, cell       >;
@@ -44,13 +54,14 @@ constexpr tpc::parser<CSV> csv =
 
 
 auto main() -> int {
-  std::ifstream stream("Examples/test.csv");
+  tpc::mapped_file file("Examples/test.csv");
+  tpc::session session(file);
   
-  auto r = csv(stream);
+  auto r = csv(session);
   
   if (r)
     std::cout << "lines: "      << r->size()        << std::endl
               << "last field: " << r->back().back() << std::endl;
   else
-    std::cerr << "Failed at " << tpc::to_string(r.pos) << std::endl;
+    std::cerr << "Failed at " << tpc::to_string(tpc::locate(session, r.pos)) << std::endl;
 }
@@ -6,7 +6,6 @@
 
 #include <cctype>
 #include <iostream>
-#include <sstream>
 #include <string>
 
 #include <tpc/parser/combinators/fold.hpp>
@@ -55,7 +54,7 @@ auto main() -> int {
   
   std::getline(std::cin, str);
   
-  std::stringstream stream(str);
+  tpc::stream stream(str);
   
   
   auto r = elements::formula(stream);
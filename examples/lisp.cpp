@@ -5,9 +5,12 @@
 // of the BSD license. See the LICENSE file for details.
 
 #include <iostream>
-#include <sstream>
 #include <string>
+#include <type_traits>
 
+#include <tpc/util/traits.hpp>
+
+#include <tpc/parser/first.hpp>
 #include <tpc/parser/combinators/between.hpp>
 #include <tpc/parser/combinators/input.hpp>
 #include <tpc/parser/combinators/join.hpp>
@@ -39,17 +42,41 @@ namespace lisp {
   }
   
   
+  template<typename N>
+  tpc::result<N> parse(tpc::stream&);
+  
+  
+  template<typename N>
+  constexpr tpc::parser<N> literal = tpc::lexeme< N, tpc::number<N> >;
+  
+  template<typename N>
+  constexpr tpc::parser<N> expr = tpc::parens<
+    N, tpc::join< char, tpc::lexeme< char, tpc::character<is_operator> >,
+                  N,    parse<N>,
+                  N,    parse<N>,
+                  N,    operation<N> >
+  >;
+}
+
+
+// The FIRST sets of the alternatives, so that only one of them is attempted.
+// `N` is checked first, lest the rules be instantiated for types other than numbers.
+template<typename N, tpc::parser<N> p>
+struct tpc::first_set<N, p, std::void_t< tpc::Util::Traits::is_number<N>,
+                                         tpc::First::rule<N, p, lisp::literal<N>> >>
+  : tpc::first_set<N, tpc::number<N>> { };
+
+template<typename N, tpc::parser<N> p>
+struct tpc::first_set<N, p, std::void_t< tpc::Util::Traits::is_number<N>,
+                                         tpc::First::rule<N, p, lisp::expr<N>> >>
+  : tpc::First::predicate< tpc::Char::is<tpc::Char::OpenParen> > { };
+
+
+namespace lisp {
   template<typename N>
   tpc::result<N> parse(tpc::stream& stream) {
-    constexpr tpc::parser<N> expr = tpc::parens<
-      N, tpc::join< char, tpc::lexeme< char, tpc::character<is_operator> >,
-                    N,    parse<N>,
-                    N,    parse<N>,
-                    N,    operation<N> >
-    >;
-    
-    return tpc::orP< N, tpc::lexeme< N, tpc::number<N> >
-                      , expr                            >(stream);
+    return tpc::orP< N, literal<N>
+                      , expr<N>    >(stream);
   }
 }
 
@@ -59,7 +86,7 @@ auto main() -> int {
   
   std::getline(std::cin, str);
   
-  std::stringstream stream(str);
+  tpc::stream stream(str);
   
   
   // Try changing `int` to `float` in the following line.
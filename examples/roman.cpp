@@ -5,13 +5,10 @@
 // of the BSD license. See the LICENSE file for details.
 
 #include <iostream>
-#include <sstream>
 #include <string>
 
 #include <tpc/parser/combinators/fold.hpp>
-#include <tpc/parser/combinators/replace.hpp>
-#include <tpc/parser/combinators/reserved.hpp>
-#include <tpc/parser/combinators/or.hpp>
+#include <tpc/parser/combinators/keywords.hpp>
 #include <tpc/parser/standard/char.hpp>
 
 
@@ -20,30 +17,29 @@ namespace roman {
     int sum(int x, int y) { return x + y; }
   }
   
-  const char i[]  = "I",  iv[] = "IV", v[]  = "V",  ix[] = "IX", x[]  = "X"
+  constexpr char i[]  = "I",  iv[] = "IV", v[]  = "V",  ix[] = "IX", x[]  = "X"
            , xl[] = "XL", l[]  = "L",  xc[] = "XC", c[]  = "C"
            , cd[] = "CD", d[]  = "D",  cm[] = "CM", m[]  = "M";
   
   
   template<const char* dig, int value>
-  constexpr tpc::parser<int> digit = tpc::replace<tpc::void_t, tpc::skipReserved<dig>,
-                                                  int,         value                  >;
+  using digit = tpc::keyword<dig, value>;
   
-  constexpr tpc::parser<int> one         = digit<i,  1>;
-  constexpr tpc::parser<int> four        = digit<iv, 4>;
-  constexpr tpc::parser<int> five        = digit<v,  5>;
-  constexpr tpc::parser<int> nine        = digit<ix, 9>;
-  constexpr tpc::parser<int> ten         = digit<x,  10>;
-  constexpr tpc::parser<int> forty       = digit<xl, 40>;
-  constexpr tpc::parser<int> fifty       = digit<l,  50>;
-  constexpr tpc::parser<int> ninety      = digit<xc, 90>;
-  constexpr tpc::parser<int> onehundred  = digit<c,  100>;
-  constexpr tpc::parser<int> fourhundred = digit<cd, 400>;
-  constexpr tpc::parser<int> fivehundred = digit<d,  500>;
-  constexpr tpc::parser<int> ninehundred = digit<cm, 900>;
-  constexpr tpc::parser<int> onethousand = digit<m,  1000>;
+  typedef digit<i,  1>    one;
+  typedef digit<iv, 4>    four;
+  typedef digit<v,  5>    five;
+  typedef digit<ix, 9>    nine;
+  typedef digit<x,  10>   ten;
+  typedef digit<xl, 40>   forty;
+  typedef digit<l,  50>   fifty;
+  typedef digit<xc, 90>   ninety;
+  typedef digit<c,  100>  onehundred;
+  typedef digit<cd, 400>  fourhundred;
+  typedef digit<d,  500>  fivehundred;
+  typedef digit<cm, 900>  ninehundred;
+  typedef digit<m,  1000> onethousand;
   
-  constexpr tpc::parser<int> unity = tpc::orP<
+  constexpr tpc::parser<int> unity = tpc::keywords<
     int, onethousand, ninehundred, fivehundred, fourhundred, onehundred
        , ninety, fifty, forty, ten, nine, five, four, one
   >;
@@ -57,7 +53,7 @@ auto main() -> int {
   
   std::getline(std::cin, str);
   
-  std::stringstream stream(str);
+  tpc::stream stream(str);
   
   
   auto r = roman::numeral(stream);
@@ -0,0 +1,59 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_BACKTRACK_HPP__
+#define __TPC_PARSER_BACKTRACK_HPP__
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <tpc/parser/base.hpp>
+
+
+// Backtracking analysis.
+// The analysis is enabled by defining TPC_BACKTRACK_ANALYSIS before including any TPC
+// header. Then, every rewind of a stream by a failed parser (see `tryP`) is recorded,
+// along with the offset it returned to, the parser that failed, and how many characters
+// must be read again. Otherwise, nothing is recorded, and the report is empty.
+// The records are kept by the stream, and grow with the input, so the analysis is meant
+// for finding the parts of a grammar that make the same input be read many times.
+
+namespace tpc {
+  // backtrack_stats: The rewinds to an offset of a stream, after a parser failed there.
+  struct backtrack_stats {
+    offset_t offset;
+    std::string rule;    // The parser that failed.
+    std::size_t rewinds; // Times the offset was entered again.
+    std::size_t reread;  // Characters read again.
+    std::string excerpt; // The input at the offset.
+  };
+  
+  
+  // backtrackReport: The rewinds recorded in a stream, by offset and by rule, sorted by
+  // characters read again, in decreasing order.
+  inline std::vector<backtrack_stats> backtrackReport(stream&);
+  
+  // backtrackAmplification: The characters read, including those read again, per
+  // character of input parsed. 1 if nothing was read again.
+  inline double backtrackAmplification(stream&);
+  
+  // backtrackDump: Writes the amplification of a stream, the `count` rules that made the
+  // most characters be read again, and the `count` worst offsets, with an excerpt of the
+  // input and a suggestion to avoid the backtracking:
+  // - When a rule fails repeatedly at the same offset, it is parsed again with the same
+  //   result every time, so memoizing it with `memo<T, p>` avoids the work.
+  // - When a rule reads much of the input before failing, the alternatives may be
+  //   reordered or their common prefix factored out, so that it fails sooner.
+  // - Otherwise, the rule fails after a few characters, which is usually cheap.
+  inline void backtrackDump(stream&, std::ostream&, std::size_t count = 10);
+}
+
+
+#include <tpc/parser/impl/backtrack.impl>
+
+#endif /* __TPC_PARSER_BACKTRACK_HPP__ */
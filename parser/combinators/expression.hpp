@@ -0,0 +1,75 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_COMBINATORS_EXPRESSION_HPP__
+#define __TPC_PARSER_COMBINATORS_EXPRESSION_HPP__
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  namespace Expression {
+    // kind: The kind of an operator.
+    enum kind {
+      prefix,  // Unary, preceding the operand.
+      postfix, // Unary, following the operand.
+      infixl,  // Binary, left associative.
+      infixr   // Binary, right associative.
+    };
+    
+    // op<k, s, p, f>: An operator of kind `k`, with symbol `s`, precedence `p`, applying
+    // the function `f` to its operands.
+    template<kind k, const char* s, unsigned p, auto f>
+    struct op {
+      static constexpr kind type = k;
+      static constexpr const char* symbol = s;
+      static constexpr unsigned precedence = p;
+      static constexpr auto function = f;
+    };
+  }
+  
+  
+  // prefix<s, p, f>, postfix<s, p, f>: Unary operators for `expression`.
+  // `s` is the symbol of the operator, which must be usable in constant expressions. `p`
+  // is its precedence: operators of higher precedence bind tighter. `f` is the function
+  // applied to the operand, of type `T (T)`, `T (const T&)` or `T (T&&)`.
+  template<const char* s, unsigned p, auto f>
+  using prefix = Expression::op<Expression::prefix, s, p, f>;
+  
+  template<const char* s, unsigned p, auto f>
+  using postfix = Expression::op<Expression::postfix, s, p, f>;
+  
+  // infixl<s, p, f>, infixr<s, p, f>: Binary operators for `expression`, left and right
+  // associative. Similar to the unary ones, but `f` is applied to both operands, and is of
+  // type `T (T, T)`, `T (const T&, const T&)` or `T (T&&, T&&)`.
+  template<const char* s, unsigned p, auto f>
+  using infixl = Expression::op<Expression::infixl, s, p, f>;
+  
+  template<const char* s, unsigned p, auto f>
+  using infixr = Expression::op<Expression::infixr, s, p, f>;
+  
+  
+  // expression<T, atom, ops...>: Parses an expression of operands parsed by `atom`, and
+  // of the operators `ops`, by precedence climbing.
+  // The operators are prefix, postfix, infixl and infixr entries. Their symbols are matched
+  // as by `keywords`, longest first, and are followed by optional whitespace, as by
+  // `lexeme`. The atom should skip its own trailing whitespace, e.g. with `lexeme`.
+  // Parenthesized subexpressions are atoms, which can be defined recursively with `parens`.
+  // Each operand and operator is parsed once, in a loop, regardless of the number of
+  // precedence levels: an expression only recurses on operators of higher precedence.
+  // Returns success containing the value of the expression, computed by the operators'
+  // functions. If an operator is not followed by its operand, returns failure.
+  template<
+    typename T, parser<T> atom,
+    typename... ops
+  >
+  result<T> expression(stream&);
+}
+
+
+#include <tpc/parser/combinators/impl/expression.impl>
+
+#endif /* __TPC_PARSER_COMBINATORS_EXPRESSION_HPP__ */
@@ -0,0 +1,57 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_COMBINATORS_KEYWORDS_HPP__
+#define __TPC_PARSER_COMBINATORS_KEYWORDS_HPP__
+
+#include <cstddef>
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  // keywords<kw, kws...>: Parses the longest of the keywords that matches the input.
+  // Returns success containing the index of that keyword in the argument list.
+  // If no keyword matches, returns failure.
+  // The keywords are compiled into a trie, which is walked in a single forward pass:
+  // each character is read once, and no alternative is backtracked. This is equivalent
+  // to an `orP` over `skipReserved<kw>` alternatives ordered from the longest to the
+  // shortest keyword, but much faster when there are many of them.
+  // The keywords must be usable in constant expressions: `constexpr char kw[] = "..."`.
+  // If a keyword is repeated, the first index is returned.
+  template<
+    const char* kw,
+    const char*... kws
+  >
+  result<std::size_t> keywords(stream&);
+  
+  
+  // keyword<kw, value>: An entry of `keywords<T, entries...>`.
+  template<
+    const char* kw,
+    auto v
+  >
+  struct keyword {
+    static constexpr const char* word = kw;
+    static constexpr auto value = v;
+  };
+  
+  // keywords<T, keyword<kw, value>...>: Parses the longest of the keywords that matches
+  // the input, like `keywords<kws...>`.
+  // Returns success containing the value mapped to that keyword, converted to `T`.
+  // If no keyword matches, returns failure.
+  template<
+    typename T,
+    typename entry,
+    typename... entries
+  >
+  result<T> keywords(stream&);
+}
+
+
+#include <tpc/parser/combinators/impl/keywords.impl>
+
+#endif /* __TPC_PARSER_COMBINATORS_KEYWORDS_HPP__ */
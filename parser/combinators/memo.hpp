@@ -0,0 +1,67 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_COMBINATORS_MEMO_HPP__
+#define __TPC_PARSER_COMBINATORS_MEMO_HPP__
+
+#include <cstddef>
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  // memo_stats: How many times a memoized parser was executed (misses), and how many
+  // times its result was reused (hits), in a stream.
+  struct memo_stats {
+    std::size_t hits, misses;
+  };
+  
+  
+  // memo<T, p>: Packrat memoization of a parser.
+  // The result of `p` is cached per offset in the stream, along with where it stopped,
+  // be it success or failure. When `memo<T, p>` is executed again at the same offset,
+  // e.g. by another alternative of an `orP`, `p` is not executed: the stream is moved to
+  // where it stopped, and the cached result is returned. This bounds the parsing time of
+  // grammars that would otherwise backtrack exponentially.
+  // The cache is kept by the stream until it is destroyed, so it grows with the input. It
+  // is a hash table, whose entries are allocated from a pool, and whose buckets are freed
+  // when reallocated as it grows. `p` must depend only on the input. Results are not
+  // cached while the stream is starved, as they may change when more input is appended.
+  template<
+    typename T, parser<T> p
+  >
+  result<T> memo(stream&);
+  
+  // memo<T, p, window>: Packrat memoization of a parser, with bounded memory.
+  // Similar to the first, but the cache has a fixed number of entries, `window`. The
+  // result at an offset evicts the one at the offset `window` characters before it, so
+  // results are kept at least for the offsets in the last `window` characters, which is
+  // suitable for streaming input.
+  template<
+    typename T, parser<T> p,
+    std::size_t window
+  >
+  result<T> memo(stream&);
+  
+  
+  // memoStats<T, p>: The hit and miss counters of `memo<T, p>` in a stream.
+  template<
+    typename T, parser<T> p
+  >
+  memo_stats memoStats(stream&);
+  
+  // memoStats<T, p, window>: The hit and miss counters of `memo<T, p, window>` in a stream.
+  template<
+    typename T, parser<T> p,
+    std::size_t window
+  >
+  memo_stats memoStats(stream&);
+}
+
+
+#include <tpc/parser/combinators/impl/memo.impl>
+
+#endif /* __TPC_PARSER_COMBINATORS_MEMO_HPP__ */
@@ -0,0 +1,92 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_COMBINATORS_PARALLEL_HPP__
+#define __TPC_PARSER_COMBINATORS_PARALLEL_HPP__
+
+#include <cstddef>
+
+#include <tpc/parser/base.hpp>
+#include <tpc/parser/container.hpp>
+
+
+namespace tpc {
+  namespace Parallel {
+    // grain: The least count of characters in a chunk of a parallel parse.
+    // Inputs smaller than two grains are parsed sequentially.
+    constexpr std::size_t grain = 256 * 1024;
+  }
+  
+  
+  // parallelRecords<T, sep, Container, parse>:
+  // Parses zero or more records with `parse`, each ended by `sep` except possibly the
+  // last one, using Container as the storage type, in parallel.
+  // The remaining input is split into chunks of about `Parallel::grain` characters, at
+  // record boundaries. The chunks are parsed by a pool of up to one thread per hardware
+  // thread, and the containers of the chunks are concatenated in order. Positions and
+  // checkpoints are those of a sequential parse, which stops at the first record that
+  // fails, as does the parallel one. If a chunk throws, the exception is rethrown, unless
+  // an earlier chunk stopped.
+  // 
+  // The records are split at line feeds that are not in a quoted field, as in CSV: a
+  // field is quoted if it starts with a double quote, at the beginning of a record or
+  // after a comma, and ends at the next double quote not escaped by a backslash, as parsed
+  // by `string`. For other formats, use the overload with a resynchronization parser.
+  // 
+  // Each chunk is parsed with its own stream, so `parse` and `sep` must not depend on the
+  // characters past the end of the record, and must be safe to execute concurrently, as
+  // the parsers of TPC are. Streams that aren't contiguous are parsed sequentially.
+  // The values are allocated with the memory resource of the stream. If it is not
+  // `std::pmr::new_delete_resource()`, e.g. the arena of a `session`, each chunk
+  // allocates from its own arena, drawing from the stream's resource under a lock. These
+  // arenas are kept until the stream is destroyed.
+  // 
+  // For more information at which types can be used on Container, see the container
+  // trait (tpc/container.hpp). Container must also be iterable, to be concatenated.
+  // `sep` must be of type `parser<T>`
+  // `parse` must be of type `parser<Container::value_type>`.
+  template<
+    typename T, parser<T> sep,
+    typename Container, parser< value_type<Container> > parse,
+    typename = is_container<Container>
+  >
+  result<Container> parallelRecords(stream&);
+  
+  // parallelRecords<T, sep, Container, parse, R, resync>:
+  // Similar to the first, but the records are split with a resynchronization parser.
+  // For each chunk, `resync` is executed from an arbitrary offset, and must consume the
+  // characters up to the beginning of the next record. If it fails, the chunk is merged
+  // into the previous one.
+  // `resync` must be of type `parser<R>`.
+  template<
+    typename T, parser<T> sep,
+    typename Container, parser< value_type<Container> > parse,
+    typename R, parser<R> resync,
+    typename = is_container<Container>
+  >
+  result<Container> parallelRecords(stream&);
+  // Example:
+  // 
+  // typedef std::vector<std::string> Line;
+  // 
+  // // A CSV file, parsed in parallel. Newlines in quoted cells don't split records.
+  // constexpr tpc::parser< std::vector<Line> > file =
+  //   tpc::parallelRecords< tpc::void_t, tpc::newline, std::vector<Line>, line >;
+  // 
+  // bool isText(char c) { return c != '\n'; }
+  // 
+  // // A log file, which never has newlines in a record, resynchronized at the next line.
+  // constexpr tpc::parser< std::vector<Entry> > log =
+  //   tpc::parallelRecords< tpc::void_t,        tpc::newline,
+  //                         std::vector<Entry>, entry,
+  //                         tpc::void_t,        tpc::line< tpc::void_t,
+  //                                                        tpc::skipSpan<isText> > >;
+}
+
+
+#include <tpc/parser/combinators/impl/parallel.impl>
+
+#endif /* __TPC_PARSER_COMBINATORS_PARALLEL_HPP__ */
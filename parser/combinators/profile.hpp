@@ -0,0 +1,91 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_COMBINATORS_PROFILE_HPP__
+#define __TPC_PARSER_COMBINATORS_PROFILE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include <tpc/parser/base.hpp>
+
+
+// Per rule profiling.
+// Profiling is enabled by defining TPC_PROFILE before including any TPC header. Otherwise,
+// `profiled<name, T, p>` is `p` itself, so that profiled grammars cost nothing, and the
+// report is empty.
+
+namespace tpc {
+  // profile_stats: The counters of the profiled rules with a name.
+  // When sampling, the counters and times are estimated from the sampled invocations.
+  struct profile_stats {
+    const char* name;
+    
+    std::uint64_t invocations;
+    std::uint64_t successes;
+    std::uint64_t failures;
+    std::uint64_t bytes;      // Consumed by the successes.
+    std::uint64_t backtracks; // Failures that consumed input, which must be rewound.
+    
+    double time; // Cumulative, in seconds, including the time of the rules invoked.
+    double self; // Excluding the time of the profiled rules invoked.
+    
+    std::uint64_t samples; // Invocations that were actually measured.
+  };
+  
+  
+  // profiled<name, T, p>: Executes `p`, recording its counters and timing under `name`.
+  // Records the invocations, successes, failures, bytes consumed, backtracks triggered,
+  // and the cumulative and self time of `p`. The self time excludes the time spent in
+  // other profiled rules, so the rules of interest must be profiled to tell them apart.
+  // The time of a recursive rule is counted at every level of recursion.
+  // The counters are shared by all streams and threads.
+  // 
+  // Example:
+  // 
+  // constexpr char rowName[] = "row";
+  // constexpr tpc::parser<Row> row = tpc::profiled<rowName, Row, rowImpl>;
+  // ...
+  // tpc::profileDump(std::cerr);
+#ifdef TPC_PROFILE
+  template<
+    const char* name,
+    typename T, parser<T> p
+  >
+  result<T> profiled(stream&);
+#else
+  template<
+    const char* name,
+    typename T, parser<T> p
+  >
+  constexpr parser<T> profiled = p;
+#endif
+  
+  
+  // profileSampling: Measures on average 1 in every `period` invocations of each profiled
+  // rule, in each thread. The other invocations cost a counter decrement, so that profiling
+  // may be left enabled in production. The default period is 1, which measures every one.
+  // The gaps between samples are random, so that rules executed in a regular rhythm are
+  // not skipped, and the counters of the report are estimated by scaling the samples.
+  inline void profileSampling(std::size_t period);
+  
+  // profileReport: The counters of every profiled rule executed, sorted by self time,
+  // in decreasing order. Rules with the same name are reported together.
+  inline std::vector<profile_stats> profileReport();
+  
+  // profileDump: Writes the report as a table.
+  inline void profileDump(std::ostream&);
+  
+  // profileReset: Clears the counters of every profiled rule.
+  inline void profileReset();
+}
+
+
+#include <tpc/parser/combinators/impl/profile.impl>
+
+#endif /* __TPC_PARSER_COMBINATORS_PROFILE_HPP__ */
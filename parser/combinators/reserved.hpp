@@ -7,6 +7,9 @@
 #ifndef __TPC_PARSER_STANDARD_RESERVED_HPP__
 #define __TPC_PARSER_STANDARD_RESERVED_HPP__
 
+#include <string>
+#include <string_view>
+
 #include <tpc/util/char.hpp>
 #include <tpc/util/functional.hpp>
 
@@ -39,6 +42,21 @@ namespace tpc {
     reserved<keyword, Util::Char::equalsInsensitive>;
   
   
+  // reservedView<kw, cmp>: Parses a string that matches `kw` via the `cmp` function.
+  // Equivalent to `reserved<kw, cmp>`, except it succeeds with a view of `kw`, instead
+  // of creating a std::string object. The view has static storage duration.
+  template<
+    const char* keyword,
+    bool (&compare)(char, char)
+  >
+  inline result<std::string_view> reservedView(stream& stream);
+  
+  // reservedView<kw>: Parses a string that matches `kw` character-wise via the `==`
+  // operator. Equivalent to `reservedView<kw, Util::Char::equals>`.
+  template<const char* keyword>
+  inline result<std::string_view> reservedView(stream& stream);
+  
+  
   // skipReserved<kw, cmp>: Parses a string that matches `kw` via the `cmp` function.
   // Equivalent to `reserved<kw, cmp>`, except it does not create a std::string object
   // equivalent to the parsed keyword on success.
@@ -0,0 +1,119 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_COMBINATORS_SINK_HPP__
+#define __TPC_PARSER_COMBINATORS_SINK_HPP__
+
+#include <cstddef>
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  // Introducing sinks.
+  // 
+  // The repetition combinators (`many`, `sepBy`, `endBy`, ...) store the values parsed in a
+  // container, which is only produced when the repetition ends. The variants in this module
+  // instead hand each value to a sink as soon as it is parsed, so the memory used doesn't
+  // grow with the count of values, and the values are processed while parsing.
+  // 
+  // A sink is a callable that takes the values by rvalue reference, or by value:
+  // . If it returns void, every value is taken.
+  // . Otherwise, it must return a value convertible to bool: false stops the repetition
+  //   after that value, which is then successful. Nothing past that value is consumed.
+  // 
+  // The combinators produce the count of values handed to the sink. They are not parsers,
+  // as they take the sink as a parameter, like `many(Container&&, stream&)`.
+  // 
+  // Values that use the memory resource of the stream are still allocated with it. In a
+  // `session`, they are kept in the arena until it is released.
+  
+  
+  // each<T, parse>(Sink&&, stream&):
+  // Parses zero or more occurrences of `parse`, handing each value to the sink.
+  // Equivalent to `many`.
+  // `parse` must be of type `parser<T>`.
+  template<
+    typename T, parser<T> parse,
+    typename Sink
+  >
+  result<std::size_t> each(Sink&&, stream&);
+  
+  // each1<T, parse>(Sink&&, stream&):
+  // Parses one or more occurrences of `parse`, handing each value to the sink.
+  // Equivalent to `many1`.
+  // `parse` must be of type `parser<T>`.
+  template<
+    typename T, parser<T> parse,
+    typename Sink
+  >
+  result<std::size_t> each1(Sink&&, stream&);
+  
+  
+  // sepBy1Each<T, sep, U, parse>(Sink&&, stream&):
+  // Parses one or more occurrences of `parse`, separated by `sep`, handing each value to
+  // the sink. Equivalent to `sepBy1`.
+  // `sep` must be of type `parser<T>`
+  // `parse` must be of type `parser<U>`.
+  template<
+    typename T, parser<T> sep,
+    typename U, parser<U> parse,
+    typename Sink
+  >
+  result<std::size_t> sepBy1Each(Sink&&, stream&);
+  
+  // sepByEach<T, sep, U, parse>(Sink&&, stream&):
+  // Parses zero or more occurrences of `parse`, separated by `sep`, handing each value to
+  // the sink. Equivalent to `sepBy`.
+  // `sep` must be of type `parser<T>`
+  // `parse` must be of type `parser<U>`.
+  template<
+    typename T, parser<T> sep,
+    typename U, parser<U> parse,
+    typename Sink
+  >
+  result<std::size_t> sepByEach(Sink&&, stream&);
+  
+  // endByEach<T, sep, U, parse>(Sink&&, stream&):
+  // Parses zero or more occurrences of `parse`, separated and ended by `sep`, handing each
+  // value to the sink. Equivalent to `endBy`.
+  // `sep` must be of type `parser<T>`
+  // `parse` must be of type `parser<U>`.
+  template<
+    typename T, parser<T> sep,
+    typename U, parser<U> parse,
+    typename Sink
+  >
+  result<std::size_t> endByEach(Sink&&, stream&);
+  
+  // sepEndByEach<T, sep, U, parse>(Sink&&, stream&):
+  // Parses zero or more occurrences of `parse`, separated and optionally ended by `sep`,
+  // handing each value to the sink. Equivalent to `sepEndBy`. If the sink stops, the
+  // separator after the last value is not consumed.
+  // `sep` must be of type `parser<T>`
+  // `parse` must be of type `parser<U>`.
+  template<
+    typename T, parser<T> sep,
+    typename U, parser<U> parse,
+    typename Sink
+  >
+  result<std::size_t> sepEndByEach(Sink&&, stream&);
+  // Example: Sums a column of a CSV file of any size, without storing the lines.
+  // 
+  // double total = 0;
+  // 
+  // auto r = tpc::sepEndByEach<tpc::void_t, tpc::newline, Line, line>(
+  //   [&total](Line&& line) { total += std::stod(line[2]); },
+  //   stream
+  // );
+  // 
+  // // *r is the count of lines.
+}
+
+
+#include <tpc/parser/combinators/impl/sink.impl>
+
+#endif /* __TPC_PARSER_COMBINATORS_SINK_HPP__ */
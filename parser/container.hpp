@@ -11,6 +11,9 @@
 
 #include <tpc/util/traits.hpp>
 
+#include <tpc/parser/result.hpp>
+#include <tpc/parser/stream.hpp>
+
 
 namespace tpc {
   // Introducing the container contract.
@@ -31,6 +34,10 @@ namespace tpc {
   // std::deque<std::string>
   // std::vector<int>
   // std::string
+  //
+  // Containers that use a `std::pmr` allocator, such as `std::pmr::vector<int>` or
+  // `std::pmr::string`, are allocated from the memory resource of the stream (see
+  // `stream::resource` and tpc/parser/session.hpp).
   
   // Alias to allow omitting the typename keyword.
   template<typename Container>
@@ -53,6 +60,18 @@ namespace tpc {
                         >::value,
                         bool
                        >::type;
+  
+  
+  // construct<Container>: An empty container for the values parsed from a stream.
+  // If the container uses a `std::pmr` allocator, it is constructed with the memory
+  // resource of the stream. Otherwise, it is default constructed.
+  template<typename Container>
+  inline Container construct(stream&);
+  
+  // empty<Container>: Parser that always succeeds, producing an empty container made
+  // by `construct`, without consuming.
+  template<typename Container>
+  inline result<Container> empty(stream&);
 }
 
 
@@ -0,0 +1,101 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_FIRST_HPP__
+#define __TPC_PARSER_FIRST_HPP__
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  namespace First {
+    // set: A set of characters, known at compile time, or unknown.
+    struct set {
+      std::uint64_t bits[4];
+      bool known;
+      
+      
+      // contains: Wether `c` is in the set. An unknown set contains every character.
+      constexpr bool contains(char c) const;
+      
+      // operator|: The union of two sets, which is unknown if either one is.
+      constexpr set operator|(const set&) const;
+    };
+    
+    
+    // unknown: The set of a parser whose FIRST set is not known.
+    constexpr set unknown = { { 0, 0, 0, 0 }, false };
+    
+    // of<pred>: The characters that satisfy `pred`, which must be constexpr.
+    template<bool (&pred)(char)>
+    constexpr set of();
+    
+    // of: The characters in `chars`.
+    constexpr set of(std::string_view chars);
+    
+    
+    // predicate<pred>: A FIRST set of the characters that satisfy `pred`, from which
+    // `first_set` may be specialized.
+    template<bool (&pred)(char)>
+    struct predicate {
+      static constexpr set value = of<pred>();
+    };
+  }
+  
+  
+  // first_set<T, p>: The FIRST set of a parser, i.e. the characters with which its input
+  // may start, known at compile time. Used by `orP` to attempt only the alternatives that
+  // may succeed on the next character.
+  // Unknown unless specialized. The standard parsers for specific characters, numbers and
+  // quoted strings are specialized in their headers, and the FIRST set of a rule may be
+  // declared next to it by specializing `first_set`:
+  // 
+  // constexpr tpc::parser<Cell> cell = tpc::orP<Cell, quoted, unquoted>;
+  // 
+  // template<>
+  // struct tpc::first_set<Cell, cell> {
+  //   static constexpr tpc::First::set value = tpc::First::of("\"")
+  //                                          | tpc::First::of<isUnquoted>();
+  // };
+  // 
+  // The set of a rule that is a template, for all its instantiations, is declared by a
+  // partial specialization on `First::rule` (see below). As `literal<N>` is then
+  // instantiated for the type of every parser whose set is needed, the types for which
+  // it is valid are checked first:
+  // 
+  // template<typename N, tpc::parser<N> p>
+  // struct tpc::first_set<N, p, std::void_t< tpc::Util::Traits::is_number<N>,
+  //                                          tpc::First::rule<N, p, literal<N>> >>
+  //   : tpc::first_set<N, tpc::number<N>> { };
+  // 
+  // The set must contain every character with which the parser may succeed. A parser
+  // that may succeed without reading any character must contain all of them.
+  // Combinators can't propagate the sets of their arguments, as the arguments of a
+  // function template can't be deduced from a reference to the function. Instead, the
+  // alternatives of an `orP` are named, and their sets declared.
+  template<typename T, parser<T> p, typename = void>
+  struct first_set {
+    static constexpr First::set value = First::unknown;
+  };
+  
+  
+  namespace First {
+    // rule<T, p, q>: `void` if `p` is the parser `q`, and a substitution failure otherwise.
+    // Specializes `first_set` for every instantiation of a parser template `q`, whose
+    // parameters can't be deduced from `p`.
+    template<typename T, parser<T> p, parser<T> q>
+    using rule = std::enable_if_t<&p == &q>;
+  }
+}
+
+
+#include <tpc/parser/impl/first.impl>
+
+#endif /* __TPC_PARSER_FIRST_HPP__ */
@@ -0,0 +1,96 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_INCREMENTAL_HPP__
+#define __TPC_PARSER_INCREMENTAL_HPP__
+
+#include <string_view>
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  // incremental<T, p>: A parse session over input that arrives in chunks.
+  // The input is a sequence of records, each one parsed by `p`, like `many<T, p>`
+  // would. Chunks are supplied with `feed`, and records are taken with `next` as soon
+  // as they are complete. The characters of the records taken are released, so the
+  // memory used is bounded by the size of the chunks and of the incomplete record.
+  // 
+  // When `p` reaches the end of the characters fed before `close`, the record may
+  // continue in the next chunk. Then `next` fails with state `more`, and the record is
+  // parsed again from its beginning once more input is fed. Records that were already
+  // taken are never parsed again.
+  // 
+  // Example:
+  // 
+  // tpc::incremental<Row, row> session;
+  // 
+  // while (receive(chunk)) {
+  //   session.feed(chunk);
+  //   
+  //   while (auto r = session.next())
+  //     process(*r);
+  // }
+  // 
+  // session.close();
+  // 
+  // while (auto r = session.next())
+  //   process(*r);
+  // 
+  // if (session.state() == session.failed)
+  //   report(session.input());
+  template<typename T, parser<T> p>
+  class incremental {
+  public:
+    // status: The state of the session after a call to `next`.
+    enum status {
+      parsed, // A record was parsed.
+      more,   // The next record is incomplete: more input must be fed.
+      done,   // The input was closed, and all of it was parsed.
+      failed  // The next record is ill-formed. The session can't proceed.
+    };
+    
+    
+    incremental();
+    
+    incremental(const incremental&) = delete;
+    incremental& operator=(const incremental&) = delete;
+    
+    
+    // feed: Appends a chunk of characters to the input.
+    // The characters are copied, so the chunk may be released after the call.
+    inline void feed(std::string_view chunk);
+    
+    // close: Indicates that no more chunks will be fed.
+    inline void close();
+    
+    
+    // next: Parses the next record.
+    // On failure, `state` indicates wether more input is needed, the input is over,
+    // or the record is ill-formed. In the later case, the result and `input` can be
+    // inspected as usual, e.g. with `illformed`.
+    // Positions and checkpoints are relative to the beginning of the input.
+    inline result<T> next();
+    
+    // state: The state of the session after the last call to `next`.
+    inline status state() const;
+    
+    // input: The stream over the characters fed.
+    inline tpc::stream& input();
+  
+  private:
+    tpc::stream in;
+    
+    position pos; // Position where the last record stopped.
+    status last;
+    bool closed;
+  };
+}
+
+
+#include <tpc/parser/impl/incremental.impl>
+
+#endif /* __TPC_PARSER_INCREMENTAL_HPP__ */
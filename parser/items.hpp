@@ -0,0 +1,115 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_ITEMS_HPP__
+#define __TPC_PARSER_ITEMS_HPP__
+
+#include <cstddef>
+#include <iterator>
+
+#include <tpc/parser/base.hpp>
+
+
+namespace tpc {
+  // items<T, p>: A range of the values parsed from a stream by `p`, produced lazily.
+  // Each step of the iteration executes `p` once, and the iteration ends when `p` fails,
+  // like `many<Container, p>` would, but without storing the values in a container. The
+  // stream is left where the last value parsed ended, so the loop may stop early, and
+  // the rest of the stream be parsed by something else.
+  // 
+  // The range is an input range: it can be iterated only once, and the values are owned
+  // by the range, so that they may be moved out. After the iteration, `pos`, `checkpoint`
+  // and `count` are those of the result `many` would produce.
+  // 
+  // Example:
+  // 
+  // tpc::stream stream(file);
+  // 
+  // for (auto& row : tpc::items<Row, row>(stream)) {
+  //   if (done(row))
+  //     break; // The rows after this one are not parsed.
+  // 
+  //   process(std::move(row));
+  // }
+  template<typename T, parser<T> p>
+  class items {
+  public:
+    // iterator: Points to the value last parsed, or is the end of the range.
+    class iterator {
+    public:
+      typedef std::input_iterator_tag iterator_category;
+      typedef T value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef T* pointer;
+      typedef T& reference;
+      
+      
+      iterator();
+      
+      
+      // operator*, operator->: The value last parsed.
+      // Precondition: the iterator is not the end of the range.
+      inline T& operator*() const;
+      inline T* operator->() const;
+      
+      // operator++: Parses the next value.
+      // Invalidates the references to the previous value.
+      inline iterator& operator++();
+      inline void operator++(int);
+      
+      inline bool operator==(const iterator&) const;
+      inline bool operator!=(const iterator&) const;
+    
+    private:
+      items* range; // Null at the end of the range.
+      
+      explicit iterator(items*);
+      
+      friend class items;
+    };
+    
+    
+    explicit items(tpc::stream&);
+    
+    items(const items&) = delete;
+    items& operator=(const items&) = delete;
+    
+    
+    // begin: Parses the first value, on the first call.
+    inline iterator begin();
+    
+    inline iterator end();
+    
+    
+    // pos: Position where the last value parsed stopped, relative to where the range
+    // started.
+    inline const position& pos() const;
+    
+    // checkpoint: Stream position where the last value parsed stopped, or 0 if none was.
+    inline offset_t checkpoint() const;
+    
+    // count: The count of values parsed.
+    inline std::size_t count() const;
+  
+  private:
+    tpc::stream& in;
+    
+    result<T> last; // Value last parsed, or failure at the end.
+    position at;
+    offset_t chk;
+    std::size_t n;
+    bool started;
+    
+    
+    // next: Parses the next value, and updates the bookkeeping.
+    inline void next();
+  };
+}
+
+
+#include <tpc/parser/impl/items.impl>
+
+#endif /* __TPC_PARSER_ITEMS_HPP__ */
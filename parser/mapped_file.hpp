@@ -0,0 +1,64 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_MAPPED_FILE_HPP__
+#define __TPC_PARSER_MAPPED_FILE_HPP__
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+
+namespace tpc {
+  // mapped_file: A file mapped read-only into memory.
+  // Requires a POSIX system (mmap).
+  // 
+  // The mapping is a contiguous range of characters, therefore a tpc::stream can be
+  // constructed directly over it, without any read() system call or buffer copy:
+  // 
+  // tpc::mapped_file file("data.csv");
+  // tpc::stream stream(file);
+  // 
+  // The kernel is advised that the file will be read sequentially, so that it can
+  // read ahead aggressively and drop pages that were already parsed.
+  // The mapping must outlive the streams constructed over it, and any view into it.
+  // If the file can't be opened or mapped, std::system_error is thrown.
+  class mapped_file {
+  public:
+    mapped_file(const char* path);
+    mapped_file(const std::string& path);
+    
+    mapped_file(mapped_file&&);
+    mapped_file& operator=(mapped_file&&);
+    
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    
+    ~mapped_file();
+    
+    
+    // data: The beginning of the mapping.
+    inline const char* data() const;
+    
+    // size: The size of the file, in bytes.
+    inline std::size_t size() const;
+    
+    // operator std::string_view: The contents of the file.
+    inline operator std::string_view() const;
+    
+  private:
+    const char* begin;
+    std::size_t length;
+    
+    // unmap: Releases the mapping, if any.
+    inline void unmap();
+  };
+}
+
+
+#include <tpc/parser/impl/mapped_file.impl>
+
+#endif /* __TPC_PARSER_MAPPED_FILE_HPP__ */
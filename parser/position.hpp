@@ -7,12 +7,52 @@
 #ifndef __TPC_PARSER_POSITION_HPP__
 #define __TPC_PARSER_POSITION_HPP__
 
+#include <algorithm>
 #include <cstddef>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+
+
+// Position tracking policies.
+// The policy is selected by defining TPC_POSITION as one of the following, before
+// including any TPC header:
+// TPC_POSITION_EAGER: The (line, column) position is computed while parsing, for every
+//                     character. This is the default.
+// TPC_POSITION_LAZY:  Only the offset of the position is computed while parsing.
+//                     The (line, column) location is computed on demand with `locate`,
+//                     from a newline index kept by the stream.
+// TPC_POSITION_NONE:  Positions are not tracked at all.
+#define TPC_POSITION_EAGER 0
+#define TPC_POSITION_LAZY  1
+#define TPC_POSITION_NONE  2
+
+#ifndef TPC_POSITION
+#define TPC_POSITION TPC_POSITION_EAGER
+#endif
+
+#if TPC_POSITION != TPC_POSITION_EAGER \
+ && TPC_POSITION != TPC_POSITION_LAZY  \
+ && TPC_POSITION != TPC_POSITION_NONE
+#error "TPC_POSITION must be one of TPC_POSITION_EAGER, TPC_POSITION_LAZY or TPC_POSITION_NONE"
+#endif
 
 
 namespace tpc {
+  // location: Location in a stream: (line, column).
+  // 1-indexed. This means the first location is (1, 1).
+  // A location of (0, 0) means that it is unknown.
+  struct location {
+    std::size_t line, column;
+  };
+  
+  // to_string(const location&): String representation of location: "(line, column)".
+  inline std::string to_string(const location& loc) {
+    return "(" + std::to_string(loc.line) + ", " + std::to_string(loc.column) + ")";
+  }
+
+
+#if TPC_POSITION == TPC_POSITION_EAGER
   // posistion: Position in a stream: (line, column).
   // 1-indexed. This means the first position is (1, 1).
   struct position {
@@ -31,6 +71,21 @@ namespace tpc {
     }
   };
   
+  // step: The position after reading the character `c`, relatively to where it was read.
+  constexpr position step(char c) {
+    return c == '\n' ? position { 2, 1 }
+                     : position { 1, 2 };
+  }
+  
+  // step: The position after reading the characters `chars`, relatively to where they
+  // were read.
+  inline position step(std::string_view chars) {
+    std::size_t lines = std::count(chars.begin(), chars.end(), '\n');
+    
+    return lines ? position { lines + 1, chars.size() - chars.rfind('\n') }
+                 : position { 1, chars.size() + 1 };
+  }
+  
   // operator+: Addition of positions.
   // Addition is not commutative on column:
   // line: line1 + line2 - 1;
@@ -42,18 +97,74 @@ namespace tpc {
                        : position(p1.line, p1.column + p2.column - 1);
   }
   
+  // to_string(const position&): String representation of position: "(line, column)".
+  inline std::string to_string(const position& pos) {
+    return "(" + std::to_string(pos.line) + ", " + std::to_string(pos.column) + ")";
+  }
+#elif TPC_POSITION == TPC_POSITION_LAZY
+  // posistion: Position in a stream: the count of characters read.
+  // 0-indexed. The (line, column) location is obtained with `locate`.
+  struct position {
+    std::size_t offset;
+    
+    constexpr position(std::size_t off = 0) : offset(off)
+    { }
+  };
+  
+  // step: The position after reading the character `c`, relatively to where it was read.
+  constexpr position step(char) {
+    return position { 1 };
+  }
+  
+  // step: The position after reading the characters `chars`, relatively to where they
+  // were read.
+  constexpr position step(std::string_view chars) {
+    return position { chars.size() };
+  }
+  
+  // operator+: Addition of positions. 0 is the identity to addition.
+  constexpr position operator+(const position& p1, const position& p2) {
+    return position { p1.offset + p2.offset };
+  }
+  
+  // to_string(const position&): String representation of position: "(offset)".
+  inline std::string to_string(const position& pos) {
+    return "(" + std::to_string(pos.offset) + ")";
+  }
+#else
+  // posistion: Position in a stream, which is not tracked.
+  struct position {
+    constexpr position()
+    { }
+  };
+  
+  // step: The position after reading a character.
+  constexpr position step(char) {
+    return position();
+  }
+  
+  // step: The position after reading the characters.
+  constexpr position step(std::string_view) {
+    return position();
+  }
+  
+  // operator+: Addition of positions, which is a no-op.
+  constexpr position operator+(const position&, const position&) {
+    return position();
+  }
+  
+  // to_string(const position&): String representation of position: "(?)".
+  inline std::string to_string(const position&) {
+    return "(?)";
+  }
+#endif
+
   // operator+=: Addition of positions.
   // Addition is not commutative.
   constexpr position& operator+=(position& p1, const position& p2) {
     p1 = p1 + p2;
     return p1;
   }
-  
-  
-  // to_string(const position&): String representation of position: "(line, column)".
-  inline std::string to_string(const position& pos) {
-    return "(" + std::to_string(pos.line) + ", " + std::to_string(pos.column) + ")";
-  }
 }
 
 
@@ -7,29 +7,50 @@
 #ifndef __TPC_PARSER_RESULT_HPP__
 #define __TPC_PARSER_RESULT_HPP__
 
-#include <optional>
+#include <cstdint>
+#include <type_traits>
 
 #include <tpc/util/traits.hpp>
 
 #include <tpc/parser/position.hpp>
+#include <tpc/parser/stream.hpp>
 
 
 namespace tpc {
+  namespace Result {
+    // engaged: The bit of a result's state that indicates success.
+    // The other bits are the checkpoint, which is never negative.
+    constexpr std::uint64_t engaged = std::uint64_t(1) << 63;
+    
+    // storage<T>: The members of a result: the value, which is only constructed on
+    // success, the position, and the state, which packs the checkpoint with wether the
+    // value is engaged. Thus a flag costs no space besides the value.
+    // For trivially copyable values, the storage is trivially copyable too, so that small
+    // results may be returned in registers, and copying a result is a plain copy.
+    template<
+      typename T,
+      bool = std::is_trivially_copyable<T>::value
+    > struct storage;
+  }
+  
+  
   // result: The result of a parser. Indicates either failure or success.
   // 
   // The parameter type T cannot be cv-qualified.
   // 
-  // On failure: The member `value` is disengaged, and `checkpoint` indicates
-  // where the last succeeded parser stopped. If it was not informed about
-  // the last parser, 0 is the default.
+  // On failure: There is no value, and `checkpoint()` indicates where the last succeeded
+  // parser stopped. If it was not informed about the last parser, 0 is the default.
+  // Constructing a failure does not construct a value of type T.
   // 
-  // On success: The member `value` is engaged with the value produced by the
-  // parser, and `checkpoint` indicates where the parser stopped.
+  // On success: The value produced by the parser is accessible like in a
+  // `std::optional<T>`, and `checkpoint()` indicates where the parser stopped.
   //
-  // The member `pos` always indicates a (line, column) position, corresponding
-  // to where the parser stopped, relatively to where it started. Parser combinators
-  // shall sum the positions produced by the parsers in the correct order to obtain
-  // a correct position relating to the begin of the stream.
+  // The member `pos` always indicates a position, corresponding to where the parser
+  // stopped, relatively to where it started. Parser combinators shall sum the positions
+  // produced by the parsers in the correct order to obtain a correct position relating
+  // to the begin of the stream. Depending on the position tracking policy (see
+  // tpc/parser/position.hpp), it is a (line, column) position, an offset, or nothing.
+  // In all cases, `locate` obtains the (line, column) location.
   // 
   template<
     typename T,
@@ -37,58 +58,66 @@ namespace tpc {
   > class result;
   
   template<typename T>
-  class result<T> {
+  class result<T> : private Result::storage<T> {
   public:
-    std::optional<T> value; // Potentially parsed value.
+    using Result::storage<T>::pos; // Position where the parser stopped.
     
-    position pos; // Position (line, column) where the parser stopped.
     
-    std::streampos checkpoint;  // Last stream position where a parser succeeded.
-                                // If the parser that generated this result succeeded,
-                                // it must be the position where that parser stopped.
+    result(const position& = position(), const offset_t& = 0);           // Failure.
+    result(const T&, const position& = position(), const offset_t& = 0); // Success.
+    result(T&&, const position& = position(), const offset_t& = 0);      // Success.
     
     
+    // checkpoint: Last stream position where a parser succeeded.
+    // If the parser that generated this result succeeded, it must be the position where
+    // that parser stopped.
+    inline offset_t checkpoint() const;
     
-    result(const position& = { 1, 1 }, const std::streampos& = 0);           // Failure.
-    result(const T&, const position& = { 1, 1 }, const std::streampos& = 0); // Success.
-    result(T&&, const position& = { 1, 1 }, const std::streampos& = 0);      // Success.
+    // checkpoint(offset_t): Sets the checkpoint.
+    inline void checkpoint(offset_t);
     
     
     // from(const result<U>&): Sums `pos` from the supplied result, indicating
     // it was the result produced by the previous parser.
     // Also assigns `checkpoint` to max(this, last), to ensure it indicates
     // the stream position of the last succeeded parser.
+    // && overload: Applied to a temporary, returns it as an rvalue, so that returning
+    // `parse(stream).from(r)` moves the value instead of copying it.
     template<typename U>
-    inline result<T>& from(const result<U>&);
+    inline result<T>& from(const result<U>&) &;
+    template<typename U>
+    inline result<T>&& from(const result<U>&) &&;
     
     // from(const position&): Sums `pos` from the supplied position, indicating
     // it was the position produced by the previous parser.
-    inline result<T>& from(const position&);
+    inline result<T>& from(const position&) &;
+    inline result<T>&& from(const position&) &&;
     
     // advance: Sums `pos` to the supplied position, indicating it was the position
     // produced by the next parser.
-    inline result<T>& advance(const position&);
+    inline result<T>& advance(const position&) &;
+    inline result<T>&& advance(const position&) &&;
     
     
-    // fail(const position& p = { 1, 1 }, const std::streampos& c = 0):
+    // fail(const position& p = position(), const offset_t& c = 0):
     // Returns a result indicating failure, relative to the supplied position
     // and checkpoint. Equivalent to `result<T>(p, c)`.
-    static inline result<T> fail(const position& p = { 1, 1 }, const std::streampos& c = 0);
+    static inline result<T> fail(const position& p = position(), const offset_t& c = 0);
     
     // fail(const result<U>& r): Returns a result indicating failure, relative to the
-    // supplied result. Equivalent to `result<T>::fail(r.pos, r.checkpoint)`.
+    // supplied result. Equivalent to `result<T>::fail(r.pos, r.checkpoint())`.
     template<typename U> static inline result<T> fail(const result<U>& r);
     
     
-    // operator bool() const: Returns wether this result indicates success (true)
-    // or failure (false).
+    // operator bool() const, has_value() const: Returns wether this result indicates
+    // success (true) or failure (false).
     constexpr inline operator bool() const;
+    constexpr inline bool has_value() const;
     
     // operator->(): Access to the contained value.
     // Precondition: this result indicates success.
     // Use of this operator in a result indicating failure is undefined behavior.
     // const overload: Const access.
-    // Equivalent to `&(*value)`.
     constexpr inline const T* operator->() const;
     constexpr inline T* operator->();
     
@@ -97,11 +126,16 @@ namespace tpc {
     // Use of this operator in a result indicating failure is undefined behavior.
     // const overloads: Const access.
     // && overloads: rvalue access.
-    // Equivalent to `*value`.
     constexpr inline const T&  operator*() const &;
     constexpr inline       T&  operator*()       &;
     constexpr inline const T&& operator*() const &&;
     constexpr inline       T&& operator*()       &&;
+    
+    // value(): Access to the contained value.
+    // Throws std::bad_optional_access if this result indicates failure.
+    inline const T& value() const &;
+    inline       T& value()       &;
+    inline       T&& value()      &&;
   };
 }
 
@@ -0,0 +1,70 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_SESSION_HPP__
+#define __TPC_PARSER_SESSION_HPP__
+
+#include <cstddef>
+#include <istream>
+#include <memory_resource>
+#include <string_view>
+
+#include <tpc/parser/stream.hpp>
+
+
+namespace tpc {
+  namespace Session {
+    // storage: The arena of a session. A base of `session`, so that it is constructed
+    // before, and destroyed after, the stream.
+    struct storage {
+      std::pmr::monotonic_buffer_resource buffer;
+    };
+  }
+  
+  
+  // session: A stream that owns an arena, from which the values produced while parsing
+  // are allocated.
+  // The arena is a bump allocator: allocating is a pointer increment, and nothing is
+  // freed until the session is destroyed, or `release`d, when everything is freed at
+  // once. The parse tree doesn't need to be destroyed element by element.
+  // 
+  // Only values that are allocated with the memory resource of the stream are placed
+  // in the arena. That is, containers that use a `std::pmr` allocator, produced by the
+  // repetition combinators (`many`, `sepBy`, ...), or by the String variants of the
+  // standard parsers (`span<String, pred>`, `string<String>`, ...).
+  // See tpc/parser/container.hpp.
+  // 
+  // Example:
+  // 
+  // typedef std::pmr::vector<std::pmr::string> Line;
+  // 
+  // tpc::session session(text);
+  // auto r = tpc::many<Line, cell>(session); // Allocated in the session's arena.
+  // 
+  // The values must not outlive the session. Moving a value into a container that uses
+  // a different allocator copies it.
+  class session : private Session::storage, public stream {
+  public:
+    session(const char* begin, const char* end); // Contiguous range [begin, end).
+    session(const char* data, std::size_t count); // Contiguous range [data, data + count).
+    session(std::string_view);                    // Contiguous range.
+    session(std::istream&);                       // Adapter for an istream.
+    session();                                    // Characters are appended later.
+    
+    
+    // arena: The memory resource of the session.
+    inline std::pmr::memory_resource* arena();
+    
+    // release: Frees all the values allocated in the arena.
+    // Precondition: no value allocated in the arena is still in use.
+    inline void release();
+  };
+}
+
+
+#include <tpc/parser/impl/session.impl>
+
+#endif /* __TPC_PARSER_SESSION_HPP__ */
@@ -7,6 +7,7 @@
 #ifndef __TPC_PARSER_STANDARD_FLOATING_HPP__
 #define __TPC_PARSER_STANDARD_FLOATING_HPP__
 
+#include <cstddef>
 #include <exception>
 #include <string>
 
@@ -14,6 +15,7 @@
 #include <tpc/util/functional.hpp>
 
 #include <tpc/parser/base.hpp>
+#include <tpc/parser/first.hpp>
 #include <tpc/parser/combinators/many.hpp>
 #include <tpc/parser/combinators/maybe.hpp>
 #include <tpc/parser/combinators/or.hpp>
@@ -21,6 +23,7 @@
 #include <tpc/parser/standard/digit.hpp>
 #include <tpc/parser/standard/integral.hpp>
 #include <tpc/parser/standard/sign.hpp>
+#include <tpc/parser/standard/span.hpp>
 
 
 namespace tpc {
@@ -32,6 +35,9 @@ namespace tpc {
   namespace Floating {
     constexpr char infinity[] = "INFINITY";
     constexpr char nan[] = "NAN";
+    
+    // first: The characters with which a floating point number may start.
+    constexpr First::set first = First::of("+-0123456789iInN");
   }
   
   
@@ -39,7 +45,7 @@ namespace tpc {
   // The punctuation mark character is determined by the stream's locale.
   constexpr parser<void_t> skipFractional =
     first< void_t, discard<char, numpunct>,
-           void_t, ignoreMany< char, digit<char> > >;
+           void_t, skipSpan<Util::Char::isDigit> >;
   
   // skipExponent: Skips a 'e' character, followed by a optionally signed integral number.
   constexpr parser<void_t> skipExponent =
@@ -68,8 +74,9 @@ namespace tpc {
   // If `stoN` throws, returns failure.
   // Otherwise, returns success containing the parsed value of floating point type `N`.
   // `N` must be a floating point type: float, double or long double.
-  // As parsing floating point numbers correctly and efficiently is extremely hard,
-  // we capture the number as a string, and then use the stdlib's parsing function.
+  // The decimal point is determined by the stream's locale.
+  // This allocates the consumed string, and relies on exceptions to report failure:
+  // prefer `floating<N>` or `localeFloating<N>`, unless a custom `stoN` is needed.
   template<
     typename N,
     N (&stoN)(const std::string&, std::size_t*),
@@ -81,23 +88,37 @@ namespace tpc {
   // floating<N>: Parses a number of the floating point type `N`.
   // The floating point representation is parsed according to the standard reference:
   // http://en.cppreference.com/w/cpp/string/basic_string/stof
+  // The decimal point is always '.', regardless of the stream's locale.
+  // The number is recognized in a single pass over the buffered characters, and then
+  // converted in place with `std::from_chars`, which rounds correctly. No allocation is
+  // made, and no exception is thrown.
+  // If the value is out of the range of `N`, returns failure.
   template<
     typename N,
     typename = Util::Traits::is_floating<N>
   >
-  constexpr parser<N> floating = undefined<N>;
+  result<N> floating(stream&);
+  
+  // localeFloating<N>: Parses a number of the floating point type `N`, whose decimal
+  // point is determined by the stream's locale (see `numpunct`).
+  // Equivalent to `floating<N>` otherwise. Numbers longer than 64 characters are copied
+  // to the heap, when the decimal point is not '.'.
+  template<
+    typename N,
+    typename = Util::Traits::is_floating<N>
+  >
+  result<N> localeFloating(stream&);
   
-  // Specialization o floating for `float`.
-  template<>
-  constexpr parser<float> floating<float> = ffloating<float, std::stof>;
   
-  // Specialization o floating for `double`.
-  template<>
-  constexpr parser<double> floating<double> = ffloating<double, std::stod>;
+  template<typename N, parser<N> p>
+  struct first_set<N, p, First::rule<N, p, floating<N>>> {
+    static constexpr First::set value = Floating::first;
+  };
   
-  // Specialization o floating for `long double`.
-  template<>
-  constexpr parser<long double> floating<long double> = ffloating<long double, std::stold>;
+  template<typename N, parser<N> p>
+  struct first_set<N, p, First::rule<N, p, localeFloating<N>>> {
+    static constexpr First::set value = Floating::first;
+  };
 }
 
 
@@ -7,11 +7,14 @@
 #ifndef __TPC_PARSER_STANDARD_INTEGRAL_HPP__
 #define __TPC_PARSER_STANDARD_INTEGRAL_HPP__
 
+#include <tpc/util/char.hpp>
 #include <tpc/util/traits.hpp>
 
 #include <tpc/parser/base.hpp>
+#include <tpc/parser/first.hpp>
 #include <tpc/parser/standard/digit.hpp>
 #include <tpc/parser/standard/sign.hpp>
+#include <tpc/parser/standard/span.hpp>
 
 
 namespace tpc {
@@ -29,11 +32,24 @@ namespace tpc {
   // Skips one or more consecutive digits, optionally preceded by a sign character.
   constexpr parser<void_t> skipIntegral =
     first< void_t, skipSign,
-           void_t, ignoreMany1< char, digit<char> > >;
+           void_t, skipSpan1<Util::Char::isDigit> >;
   
   // skipUIntegral:
   // Skips one or more consecutive digits.
-  constexpr parser<void_t> skipUIntegral = ignoreMany1< char, digit<char> >;
+  constexpr parser<void_t> skipUIntegral = skipSpan1<Util::Char::isDigit>;
+  
+  
+  namespace Integral {
+    // first: The characters with which an integral number may start.
+    constexpr First::set first = First::of("+-0123456789");
+  }
+  
+  // `N` is checked first, lest `integral<bool>` be instantiated.
+  template<typename N, parser<N> p>
+  struct first_set<N, p, std::void_t< Util::Traits::is_number<N>,
+                                      First::rule<N, p, integral<N>> >> {
+    static constexpr First::set value = Integral::first;
+  };
 }
 
 
@@ -10,6 +10,7 @@
 #include <tpc/util/traits.hpp>
 
 #include <tpc/parser/base.hpp>
+#include <tpc/parser/first.hpp>
 #include <tpc/parser/standard/integral.hpp>
 #include <tpc/parser/standard/floating.hpp>
 
@@ -29,8 +30,7 @@ namespace tpc {
   // number<N>, floating N:
   // Parses a valid representation of the N floating point type, according to the reference:
   // http://en.cppreference.com/w/cpp/string/basic_string/stof
-  // In fact, if stof/stod/stold throws when applied to the consumed floating literal,
-  // then number<N> will return failure.
+  // The decimal point is '.'. If the value is out of the range of N, returns failure.
   template<
     typename N,
     Util::Traits::is_floating<N> = true
@@ -38,6 +38,15 @@ namespace tpc {
   inline result<N> number(stream& stream) {
     return floating<N>(stream);
   }
+  
+  
+  // `N` is checked first, lest `number<bool>` be instantiated.
+  template<typename N, parser<N> p>
+  struct first_set<N, p, std::void_t< Util::Traits::is_number<N>,
+                                      First::rule<N, p, number<N>> >> {
+    static constexpr First::set value = std::is_integral<N>::value ? Integral::first
+                                                                   : Floating::first;
+  };
 }
 
 
@@ -0,0 +1,87 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_STANDARD_SPAN_HPP__
+#define __TPC_PARSER_STANDARD_SPAN_HPP__
+
+#include <string>
+#include <string_view>
+
+#include <tpc/util/functional.hpp>
+#include <tpc/util/traits.hpp>
+
+#include <tpc/parser/base.hpp>
+#include <tpc/parser/container.hpp>
+
+
+// Span parsers: Repetitions of a character predicate.
+// The span parsers are equivalent to the repetition combinators applied to
+// `character<pred>`, but instead of parsing each character through `tryP`, they classify
+// the buffered characters in bulk (see tpc/util/scan.hpp), and append or skip the whole
+// run at once. A span stops at the first character that doesn't match the predicate,
+// which is not consumed, or at EOS.
+
+namespace tpc {
+  using void_t = Util::Functional::void_t;
+  
+  // span<pred>: Parses zero or more characters matching the predicate.
+  // Equivalent to `many<std::string, character<pred>>`.
+  template<bool (&predicate)(char)>
+  inline result<std::string> span(stream&);
+  
+  // span<pred>(String&&, stream&): Parses zero or more characters matching the
+  // predicate, appending them to the supplied string.
+  // Equivalent to `many<String, character<pred>>(String&&, stream&)`.
+  template<
+    bool (&predicate)(char),
+    typename String, typename = Util::Traits::isnt_cvref<String>
+  >
+  inline result<String> span(String&&, stream&);
+  
+  // span1<pred>: Parses one or more characters matching the predicate.
+  // Equivalent to `many1<std::string, character<pred>>`.
+  template<bool (&predicate)(char)>
+  inline result<std::string> span1(stream&);
+  
+  
+  // span<String, pred>, span1<String, pred>: Equivalent to `span<pred>` and
+  // `span1<pred>`, but producing a `String`, such as `std::pmr::string`, which is made
+  // by `construct` (see tpc/parser/container.hpp).
+  template<typename String, bool (&predicate)(char)>
+  inline result<String> span(stream&);
+  
+  template<typename String, bool (&predicate)(char)>
+  inline result<String> span1(stream&);
+  
+  
+  // skipSpan<pred>: Skips zero or more characters matching the predicate.
+  // Equivalent to `ignoreMany<char, character<pred>>`.
+  template<bool (&predicate)(char)>
+  inline result<void_t> skipSpan(stream&);
+  
+  // skipSpan1<pred>: Skips one or more characters matching the predicate.
+  // Equivalent to `ignoreMany1<char, character<pred>>`.
+  template<bool (&predicate)(char)>
+  inline result<void_t> skipSpan1(stream&);
+  
+  
+  // spanView<pred>: Parses zero or more characters matching the predicate.
+  // Equivalent to `span<pred>`, except that it returns a view of the characters in the
+  // stream, instead of a copy. See `consumptionView`.
+  template<bool (&predicate)(char)>
+  inline result<std::string_view> spanView(stream&);
+  
+  // spanView1<pred>: Parses one or more characters matching the predicate.
+  // Equivalent to `span1<pred>`, except that it returns a view of the characters in the
+  // stream, instead of a copy. See `consumptionView`.
+  template<bool (&predicate)(char)>
+  inline result<std::string_view> spanView1(stream&);
+}
+
+
+#include <tpc/parser/standard/impl/span.impl>
+
+#endif /* __TPC_PARSER_STANDARD_SPAN_HPP__ */
@@ -1,59 +1,132 @@
-// Copyright (C) 2017 gahag
-// All rights reserved.
-//
-// This software may be modified and distributed under the terms
-// of the BSD license. See the LICENSE file for details.
-
-#ifndef __TPC_PARSER_STANDARD_STRING_HPP__
-#define __TPC_PARSER_STANDARD_STRING_HPP__
-
-#include <string>
-
-#include <tpc/parser/base.hpp>
-#include <tpc/parser/combinators/between.hpp>
-#include <tpc/parser/standard/char.hpp>
-
-
-namespace tpc {
-  // rawString: Parses a string of characters.
-  // Parses characters until EOS or a unescaped double quote is reached.
-  // A backslash preceding a backslash or a double quote is considered a escape sequence,
-  // and is appended to the result string without the preceding backslash.
-  inline result<std::string> rawString(stream&);
-  
-  // rawString<esc>: Parses a string of characters.
-  // Parses characters until EOS or a unescaped double quote is reached.
-  // Additionally, a rule for escaping characters is supplied:
-  // A backslash preceding a backslash, double quote or a character parsed by `esc`
-  // is considered a escape sequence, and is appended to the result string without
-  // the preceding backslash.
-  template<parser<char> escapable>
-  inline result<std::string> rawString(stream&);
-  
-  
-  // string: Parses a string between double quotes.
-  // A backslash preceding a backslash or a double quote is considered a escape sequence,
-  // and is appended to the result string without the preceding backslash.
-  // If EOS is reached, returns failure.
-  inline result<std::string> string(stream& stream) {
-    return between< char,        doubleQuote,
-                    std::string, rawString    >(stream);
-  }
-  
-  // string<esc>: Parses a string between double quotes.
-  // Additionally, a rule for escaping characters is supplied:
-  // A backslash preceding a backslash, double quote or a character parsed by `esc`
-  // is considered a escape sequence, and is appended to the result string without
-  // the preceding backslash.
-  // If EOS is reached, returns failure.
-  template<parser<char> escapable>
-  inline result<std::string> string(stream& stream) {
-    return between< char,        doubleQuote,
-                    std::string, rawString<escapable> >(stream);
-  }
-}
-
-
-#include <tpc/parser/standard/impl/string.impl>
-
-#endif /* __TPC_PARSER_STANDARD_STRING_HPP__ */
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_STANDARD_STRING_HPP__
+#define __TPC_PARSER_STANDARD_STRING_HPP__
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <tpc/util/traits.hpp>
+
+#include <tpc/parser/base.hpp>
+#include <tpc/parser/container.hpp>
+#include <tpc/parser/first.hpp>
+#include <tpc/parser/combinators/between.hpp>
+#include <tpc/parser/standard/char.hpp>
+
+
+namespace tpc {
+  // rawString: Parses a string of characters.
+  // Parses characters until EOS or a unescaped double quote is reached.
+  // A backslash preceding a backslash or a double quote is considered a escape sequence,
+  // and is appended to the result string without the preceding backslash.
+  inline result<std::string> rawString(stream&);
+  
+  // rawString<esc>: Parses a string of characters.
+  // Parses characters until EOS or a unescaped double quote is reached.
+  // Additionally, a rule for escaping characters is supplied:
+  // A backslash preceding a backslash, double quote or a character parsed by `esc`
+  // is considered a escape sequence, and is appended to the result string without
+  // the preceding backslash.
+  template<parser<char> escapable>
+  inline result<std::string> rawString(stream&);
+  
+  
+  // string: Parses a string between double quotes.
+  // A backslash preceding a backslash or a double quote is considered a escape sequence,
+  // and is appended to the result string without the preceding backslash.
+  // If EOS is reached, returns failure.
+  inline result<std::string> string(stream& stream) {
+    return between< char,        doubleQuote,
+                    std::string, rawString    >(stream);
+  }
+  
+  // string<esc>: Parses a string between double quotes.
+  // Additionally, a rule for escaping characters is supplied:
+  // A backslash preceding a backslash, double quote or a character parsed by `esc`
+  // is considered a escape sequence, and is appended to the result string without
+  // the preceding backslash.
+  // If EOS is reached, returns failure.
+  template<parser<char> escapable>
+  inline result<std::string> string(stream& stream) {
+    return between< char,        doubleQuote,
+                    std::string, rawString<escapable> >(stream);
+  }
+  
+  
+  // rawString<String>, rawString<String, esc>, string<String>, string<String, esc>:
+  // Equivalent to the above, but producing a `String`, such as `std::pmr::string`, which
+  // is made by `construct` (see tpc/parser/container.hpp).
+  template<typename String>
+  inline result<String> rawString(stream&);
+  
+  template<typename String, parser<char> escapable>
+  inline result<String> rawString(stream&);
+  
+  template<typename String>
+  inline result<String> string(stream& stream) {
+    return between< char,   doubleQuote,
+                    String, rawString<String> >(stream);
+  }
+  
+  template<typename String, parser<char> escapable>
+  inline result<String> string(stream& stream) {
+    return between< char,   doubleQuote,
+                    String, rawString<String, escapable> >(stream);
+  }
+  
+  
+  // rawStringView: Parses a string of characters.
+  // Equivalent to `rawString`, except that it returns a view of the parsed characters
+  // in the stream, instead of a copy. Therefore, escape sequences are kept in the view,
+  // backslash included. See `consumptionView`.
+  inline result<std::string_view> rawStringView(stream&);
+  
+  // rawStringView<esc>: Parses a string of characters.
+  // Equivalent to `rawString<esc>`, except that it returns a view of the parsed
+  // characters in the stream, instead of a copy. Therefore, escape sequences are kept
+  // in the view, backslash included. See `consumptionView`.
+  template<parser<char> escapable>
+  inline result<std::string_view> rawStringView(stream&);
+  
+  
+  // stringView: Parses a string between double quotes.
+  // Equivalent to `string`, except that it returns a view of the characters between
+  // the quotes, escape sequences included. See `rawStringView`.
+  inline result<std::string_view> stringView(stream& stream) {
+    return between< char,             doubleQuote,
+                    std::string_view, rawStringView >(stream);
+  }
+  
+  // stringView<esc>: Parses a string between double quotes.
+  // Equivalent to `string<esc>`, except that it returns a view of the characters
+  // between the quotes, escape sequences included. See `rawStringView<esc>`.
+  template<parser<char> escapable>
+  inline result<std::string_view> stringView(stream& stream) {
+    return between< char,             doubleQuote,
+                    std::string_view, rawStringView<escapable> >(stream);
+  }
+  
+  
+  // The FIRST sets of the quoted strings, for `orP`. Those of `string<esc>`,
+  // `string<String, esc>` and `stringView<esc>` can't be declared, as `esc` can't be
+  // deduced.
+  template<> struct first_set<std::string, string> : First::predicate<Char::is<Char::DoubleQuote>> { };
+  template<> struct first_set<std::string_view, stringView> : First::predicate<Char::is<Char::DoubleQuote>> { };
+  
+  // `String` is checked first, lest `string<String>` be instantiated for any type.
+  template<typename String, parser<String> p>
+  struct first_set<String, p, std::void_t< Util::Traits::is_string<String>,
+                                           First::rule<String, p, string<String>> >>
+    : First::predicate<Char::is<Char::DoubleQuote>> { };
+}
+
+
+#include <tpc/parser/standard/impl/string.impl>
+
+#endif /* __TPC_PARSER_STANDARD_STRING_HPP__ */
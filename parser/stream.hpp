@@ -0,0 +1,272 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_PARSER_STREAM_HPP__
+#define __TPC_PARSER_STREAM_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <locale>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <tpc/parser/position.hpp>
+
+
+namespace tpc {
+  // offset_t: Position in a stream, as the count of characters from where it started.
+  // A plain 64-bit integer, therefore cheap to copy, compare and subtract, and well
+  // defined for inputs larger than 4 GB.
+  typedef std::int64_t offset_t;
+  
+  
+  // stream: The input of a parser.
+  //
+  // A stream reads characters from one of the following sources:
+  // . A contiguous range of characters, such as a `std::string_view`. This is the fast
+  //   path: reading a character is a pointer increment, and backtracking is a pointer
+  //   assignment. The characters must outlive the stream.
+  // . A `std::istream`, such as `std::ifstream`, `std::stringstream` or `std::cin`.
+  //   The istream doesn't need to support seeking: characters are read in chunks into
+  //   a buffer, the rewind window, which is then parsed as a contiguous range.
+  // . Chunks of characters appended to the stream with `append`, until `close`. When a
+  //   parser reaches the end of the appended characters before the stream is closed, it
+  //   reads EOS and the stream is marked as `starved`. See tpc/parser/incremental.hpp.
+  //
+  // The rewind window keeps the characters from the oldest outstanding mark (see `mark`)
+  // up to the last character read. Characters before it are released when more input is
+  // needed, so the memory used is bounded by the lookahead the parsers actually use.
+  //
+  // Positions in a stream (`tellg`, `seekg`) are relative to where the stream started,
+  // i.e. the beginning of the range, or the position of the istream at construction.
+  //
+  // The interface mimics the subset of `std::istream` used by the parsers.
+  class stream {
+  public:
+    typedef std::char_traits<char> traits_type;
+    
+    // chunk: How many characters are read at most from an istream at once.
+    static constexpr std::size_t chunk = 64 * 1024;
+    
+    
+    stream(const char* begin, const char* end); // Contiguous range [begin, end).
+    stream(const char* data, std::size_t count); // Contiguous range [data, data + count).
+    stream(std::string_view);                    // Contiguous range.
+    stream(std::istream&);                       // Adapter for an istream.
+    stream();                                    // Characters are appended later.
+    
+    stream(const stream&) = delete;
+    stream& operator=(const stream&) = delete;
+    
+    
+    // get: Reads the next character, or EOS if the end of the stream has been reached.
+    inline char get();
+    
+    // tellg: The current position in the stream.
+    inline offset_t tellg() const;
+    
+    // seekg: Sets the current position in the stream.
+    // Fails if the position is not in the rewind window.
+    inline stream& seekg(offset_t);
+    
+    
+    // mark: Returns the current position, and guarantees that it will be possible to
+    // seek back to it until the correspondent `unmark`.
+    // Marks must be nested: the last mark is the first to be unmarked.
+    inline offset_t mark();
+    
+    // unmark: Releases the last mark.
+    inline void unmark();
+    
+    // rewind: Returns to a position obtained from an outstanding `mark`.
+    // The rewind window always contains a marked position, so unlike `seekg`, rewinding
+    // can't fail, and is not checked. This is how parsers backtrack.
+    // Precondition: the position was returned by `mark`, and is not yet unmarked.
+    inline void rewind(offset_t);
+    
+    
+    // fail: Wether the last seek failed.
+    inline bool fail() const;
+    
+    // clear: Resets the failure state.
+    inline void clear();
+    
+    
+    // getloc: The locale of the stream.
+    inline std::locale getloc() const;
+    
+    // imbue: Sets the locale of the stream, returning the previous one.
+    inline std::locale imbue(const std::locale&);
+    
+    // decimal_point: The decimal point character of the stream's locale.
+    // Cached at construction and by `imbue`, as querying the locale is expensive.
+    inline char decimal_point() const;
+    
+    
+    // resource: The memory resource for the values produced while parsing, such as the
+    // containers of the repetition combinators (see `construct` in
+    // tpc/parser/container.hpp). By default, `std::pmr::get_default_resource()`.
+    inline std::pmr::memory_resource* resource() const;
+    
+    // resource(std::pmr::memory_resource*): Sets the memory resource for the values
+    // produced while parsing. The resource must outlive the values.
+    // See tpc/parser/session.hpp for a stream that owns an arena.
+    inline void resource(std::pmr::memory_resource*);
+    
+    
+    // buffered: The characters already available, from the current position on.
+    // The view is invalidated by `refill` and `append`.
+    inline std::string_view buffered() const;
+    
+    // view: The `count` characters from position `pos`, as a view into the buffer.
+    // Precondition: the characters were read, and are still in the rewind window,
+    // e.g. because a mark taken at `pos` is outstanding.
+    // For contiguous streams, the view is valid as long as the range is. Otherwise,
+    // it is invalidated by `refill` and `append`, i.e. when more characters are read.
+    inline std::string_view view(offset_t pos, std::size_t count) const;
+    
+    // skip: Advances the current position by `count` characters.
+    // Precondition: `count <= buffered().size()`.
+    inline void skip(std::size_t count);
+    
+    // refill: Reads more characters from the istream into the rewind window.
+    // Returns false if no more characters are available. Always false for contiguous
+    // streams, and for appended streams, which are then marked as starved if not closed.
+    inline bool refill();
+    
+    
+    // append: Appends characters to a stream that was constructed empty.
+    // Resets the starved state. The characters are copied into the rewind window.
+    // Precondition: the stream was constructed empty, and was not closed.
+    inline void append(std::string_view);
+    
+    // close: Indicates that no more characters will be appended.
+    inline void close();
+    
+    // starved: Wether a parser has reached the end of the appended characters since the
+    // last `append`, while the stream was not closed. In that case, the parser has read
+    // EOS in place of characters that were not yet available.
+    inline bool starved() const;
+    
+    
+    // contiguous: Wether the stream reads from a contiguous range of characters
+    // supplied at construction.
+    inline bool contiguous() const;
+    
+    // data: The beginning of the contiguous range.
+    // Precondition: the stream is contiguous.
+    inline const char* data() const;
+    
+    // size: The size of the contiguous range.
+    // Precondition: the stream is contiguous.
+    inline std::size_t size() const;
+    
+    // source: The adapted istream, or nullptr if the stream is contiguous.
+    inline std::istream* source() const;
+    
+    // seekable: Wether characters released from the rewind window can be read again,
+    // i.e. the stream is contiguous, or the adapted istream supports seeking.
+    // Determined once, at construction.
+    inline bool seekable() const;
+    
+    
+    // session_data: State kept by a combinator for as long as the stream is parsed, such
+    // as the table of `memo`. Each kind of state is stored in its own slot, obtained once
+    // with `session_slot`, and destroyed with the stream.
+    struct session_data {
+      virtual ~session_data() = default;
+    };
+    
+    // session_slot: Allocates a new slot for session data, common to all streams.
+    static inline std::size_t session_slot();
+    
+    // session: The session data in `slot`, which is null until it is set.
+    inline std::unique_ptr<session_data>& session(std::size_t slot);
+    
+#if TPC_POSITION == TPC_POSITION_LAZY
+    // locate: The (line, column) location of the character at `offset`.
+    // The location is computed from a newline index, which is extended as needed by
+    // counting the newlines in the buffer. The characters released from the rewind
+    // window are indexed before being released.
+    // Throws std::out_of_range if the offset is past the characters read, or if it is
+    // before the rewind window, and not in the newline index.
+    inline location locate(offset_t);
+#endif
+  
+  private:
+    const char* begin; // Contiguous range, or the rewind window.
+    const char* cur;
+    const char* end;
+    
+    offset_t base; // Position of `begin`.
+    
+    std::istream* src;        // Adapted istream, if any.
+    std::streampos origin;    // Position of the adapted istream at construction,
+                              // or -1 if it does not support seeking.
+    std::vector<char> window; // Storage for the rewind window.
+    
+    std::size_t marks;     // Count of outstanding marks.
+    offset_t anchor;       // Position of the oldest outstanding mark.
+    
+    bool failed;
+    
+    bool fed;      // Wether characters are supplied with `append`.
+    bool pending;  // Wether more characters may be appended.
+    bool starving;
+    
+    std::locale locale;
+    char point; // Decimal point of the locale.
+    
+    std::pmr::memory_resource* memory; // Resource for the values produced.
+    
+    std::vector< std::unique_ptr<session_data> > sessions; // Indexed by slot.
+    
+#if TPC_POSITION == TPC_POSITION_LAZY
+    // line_mark: The line, and the offset where that line starts, at a given offset.
+    struct line_mark {
+      offset_t offset;
+      std::size_t line;
+      offset_t start;
+    };
+    
+    std::vector<line_mark> lines; // Newline index, ordered by offset.
+                                  // There's one mark every `chunk` characters, and one
+                                  // where each release of the rewind window stopped.
+    
+    // scan: Counts the newlines from `mark` up to `offset`, returning the mark at `offset`.
+    // Precondition: the characters are in the buffer.
+    inline line_mark scan(const line_mark& mark, offset_t offset) const;
+    
+    // index: Extends the newline index up to `offset`.
+    // Precondition: the characters are in the buffer.
+    inline void index(offset_t offset);
+#endif
+    
+    
+    // underflow: Reads a character when the buffered characters are exhausted.
+    inline char underflow();
+    
+    // punctuation: The decimal point character of a locale.
+    static inline char punctuation(const std::locale&);
+    
+    // reserve: Makes room for `count` more characters in the rewind window,
+    // releasing the characters before the oldest mark.
+    inline void reserve(std::size_t count);
+    
+    
+    friend std::string read(stream&, offset_t, std::size_t);
+  };
+}
+
+
+#include <tpc/parser/impl/stream.impl>
+
+#endif /* __TPC_PARSER_STREAM_HPP__ */
@@ -0,0 +1,185 @@
+// Copyright (C) 2017 gahag
+// All rights reserved.
+//
+// This software may be modified and distributed under the terms
+// of the BSD license. See the LICENSE file for details.
+
+#ifndef __TPC_UTIL_SCAN_HPP__
+#define __TPC_UTIL_SCAN_HPP__
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+
+namespace tpc::Util::Scan {
+  // charset: A set of characters, built from a predicate, that can be tested in bulk.
+  // Besides the lookup table, the set is encoded in two tables indexed by the low and the
+  // high nibble of a character: `c` is in the set iff `low[c & 0xF] & high[c >> 4]`.
+  // Each bit stands for a group of high nibbles which match the same low nibbles, so the
+  // encoding only exists for sets with at most 8 such groups (`nibbles`). This covers
+  // the usual character classes, and allows classifying 16 or 32 characters at once with
+  // a byte shuffle.
+  struct charset {
+    bool table[256];
+    
+    std::uint8_t low[16];
+    std::uint8_t high[16];
+    bool nibbles;
+    
+    
+    template<typename Predicate>
+    explicit charset(Predicate predicate)
+    : low(), high(), nibbles(true)
+    {
+      std::uint16_t rows[16] = { }; // The low nibbles in the set, by high nibble.
+      
+      for (int c = 0; c < 256; c++) {
+        table[c] = predicate(char(c));
+        
+        if (table[c])
+          rows[c >> 4] |= 1 << (c & 0xF);
+      }
+      
+      std::uint16_t groups[8];
+      int count = 0;
+      
+      for (int h = 0; h < 16 && nibbles; h++) {
+        if (!rows[h])
+          continue;
+        
+        int g = 0;
+        while (g < count && groups[g] != rows[h])
+          g++;
+        
+        if (g == count) {
+          if (count == 8) {
+            nibbles = false; // Too many groups: only the lookup table is used.
+            break;
+          }
+          
+          groups[count++] = rows[h];
+          
+          for (int l = 0; l < 16; l++)
+            if (rows[h] >> l & 1)
+              low[l] |= 1 << g;
+        }
+        
+        high[h] |= 1 << g;
+      }
+    }
+  };
+  
+  // of<pred>: The charset of the characters that match `pred`.
+  // Built on first use.
+  template<bool (&predicate)(char)>
+  inline const charset& of() {
+    static const charset set(predicate);
+    return set;
+  }
+  
+  
+  // span: The length of the longest prefix of [begin, end) whose characters are in `set`.
+  // With AVX2 or SSSE3 enabled at compile time, 32 or 16 characters are classified at
+  // once. Otherwise, and for the remaining characters, the lookup table is used.
+  inline std::size_t span(const charset& set, const char* begin, const char* end) {
+    const char* it = begin;
+    
+#if defined(__AVX2__)
+    if (set.nibbles) {
+      const __m256i low  = _mm256_broadcastsi128_si256(
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.low))
+                           );
+      const __m256i high = _mm256_broadcastsi128_si256(
+                             _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.high))
+                           );
+      const __m256i nibble = _mm256_set1_epi8(0x0F);
+      
+      for (; end - it >= 32; it += 32) {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+        
+        __m256i in = _mm256_and_si256(
+          _mm256_shuffle_epi8(low,  _mm256_and_si256(chars, nibble)),
+          _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi16(chars, 4), nibble))
+        );
+        
+        std::uint32_t out = _mm256_movemask_epi8( // Characters not in the set.
+          _mm256_cmpeq_epi8(in, _mm256_setzero_si256())
+        );
+        
+        if (out)
+          return (it - begin) + __builtin_ctz(out);
+      }
+    }
+#elif defined(__SSSE3__)
+    if (set.nibbles) {
+      const __m128i low    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.low));
+      const __m128i high   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.high));
+      const __m128i nibble = _mm_set1_epi8(0x0F);
+      
+      for (; end - it >= 16; it += 16) {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        
+        __m128i in = _mm_and_si128(
+          _mm_shuffle_epi8(low,  _mm_and_si128(chars, nibble)),
+          _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(chars, 4), nibble))
+        );
+        
+        std::uint32_t out = _mm_movemask_epi8( // Characters not in the set.
+          _mm_cmpeq_epi8(in, _mm_setzero_si128())
+        );
+        
+        if (out)
+          return (it - begin) + __builtin_ctz(out);
+      }
+    }
+#endif
+    
+    while (it != end && set.table[static_cast<unsigned char>(*it)])
+      it++;
+    
+    return it - begin;
+  }
+  
+  
+  // until<ds...>: The length of the longest prefix of [begin, end) that doesn't contain
+  // any of the delimiters `ds`.
+  // With SSE2 or AVX2 enabled at compile time, 16 or 32 characters are compared at once.
+  template<char... delimiters>
+  inline std::size_t until(const char* begin, const char* end) {
+    const char* it = begin;
+    
+#if defined(__AVX2__)
+    for (; end - it >= 32; it += 32) {
+      __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(it));
+      
+      __m256i found = _mm256_setzero_si256();
+      ((found = _mm256_or_si256(found, _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(delimiters)))), ...);
+      
+      if (std::uint32_t mask = _mm256_movemask_epi8(found))
+        return (it - begin) + __builtin_ctz(mask);
+    }
+#elif defined(__SSE2__)
+    for (; end - it >= 16; it += 16) {
+      __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+      
+      __m128i found = _mm_setzero_si128();
+      ((found = _mm_or_si128(found, _mm_cmpeq_epi8(chars, _mm_set1_epi8(delimiters)))), ...);
+      
+      if (std::uint32_t mask = _mm_movemask_epi8(found))
+        return (it - begin) + __builtin_ctz(mask);
+    }
+#endif
+    
+    while (it != end && ((*it != delimiters) && ...))
+      it++;
+    
+    return it - begin;
+  }
+}
+
+
+#endif /* __TPC_UTIL_SCAN_HPP__ */
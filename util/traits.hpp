@@ -8,6 +8,7 @@
 #define __TPC_UTIL_TRAITS_HPP__
 
 #include <type_traits>
+#include <utility>
 
 
 namespace tpc::Util::Traits {
@@ -39,6 +40,15 @@ namespace tpc::Util::Traits {
                                          >::type;
   
   
+  template<typename S> // A string of `char` that can be appended to.
+  using is_string = typename std::enable_if<
+                               std::is_same<
+                                 decltype(std::declval<S&>().append("", 0)), S&
+                               >::value,
+                               bool
+                             >::type;
+  
+  
   template<typename N>
   using is_numeric = typename std::enable_if<std::is_arithmetic<N>::value, bool>::type;
   
@@ -48,6 +58,12 @@ namespace tpc::Util::Traits {
   template<typename N>
   using is_floating = typename std::enable_if<std::is_floating_point<N>::value, bool>::type;
   
+  template<typename N> // An arithmetic type, other than `bool`.
+  using is_number = typename std::enable_if<
+                               std::is_arithmetic<N>::value && !std::is_same<N, bool>::value,
+                               bool
+                             >::type;
+  
   template<typename N>
   using is_signed = typename std::enable_if<std::is_signed<N>::value, bool>::type;
   